@@ -0,0 +1,24 @@
+#pragma once
+
+#include <chrono>
+
+namespace Microbenchmarks
+{
+  /**
+   * @brief Runs a function repeatedly
+   * @param nRuns Number of times to run the function
+   * @param func The function to measure
+   * @return Average duration of a run in nanoseconds
+   */
+  template <typename Func> double measure(int nRuns, Func func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < nRuns; ++i)
+      func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / nRuns;
+  }
+
+  void runSystemDispatchBenchmark();
+  void runTransformBenchmark();
+  void runParticleBenchmark();
+} // namespace Microbenchmarks
\ No newline at end of file
@@ -0,0 +1,20 @@
+#include "Benchmarks.hpp"
+
+#include <TritiumEngine/Utilities/Logger.hpp>
+#include <TritiumEngine/Utilities/SimdUtils.hpp>
+
+#include <cstdlib>
+
+using namespace TritiumEngine::Utilities;
+
+int main() {
+  Logger::info("[Microbenchmarks] Widest supported instruction set: {}",
+               SimdUtils::GetLevelName(SimdUtils::GetSupportedLevel()));
+
+  Microbenchmarks::runSystemDispatchBenchmark();
+  Microbenchmarks::runTransformBenchmark();
+  Microbenchmarks::runParticleBenchmark();
+
+  Logger::info("[Microbenchmarks] Program exited successfully!");
+  return EXIT_SUCCESS;
+}
\ No newline at end of file
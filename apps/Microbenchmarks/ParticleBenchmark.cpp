@@ -0,0 +1,51 @@
+#include "Benchmarks.hpp"
+
+#include <TritiumEngine/Physics/ParticleBatch.hpp>
+#include <TritiumEngine/Utilities/Logger.hpp>
+#include <TritiumEngine/Utilities/SimdUtils.hpp>
+
+#include <cmath>
+
+using namespace TritiumEngine::Physics;
+using namespace TritiumEngine::Utilities;
+
+namespace Microbenchmarks
+{
+  namespace
+  {
+    constexpr size_t N_PARTICLES = 1000000;
+    constexpr int N_RUNS         = 20;
+    constexpr float BOX_SIZE     = 1000.f;
+    constexpr float FRAME_DT     = 1.f / 60.f;
+    constexpr double FRAME_NS    = 1e9 / 60.0;
+  } // namespace
+
+  /**
+   * @brief Measures moving particles and reflecting them off the walls of a box with the SIMD
+   * kernels of ParticleBatch, for each instruction set supported by the CPU. Throughput is also
+   * given as the number of particles a single thread moves within a 60 Hz frame.
+   */
+  void runParticleBenchmark() {
+    Logger::info("[Microbenchmarks] Box particles, {} particles, {} runs", N_PARTICLES, N_RUNS);
+
+    ParticleBatch batch;
+    batch.resize(N_PARTICLES);
+    for (size_t i = 0; i < N_PARTICLES; ++i) {
+      float t = static_cast<float>(i);
+      batch.set(i, glm::vec3{std::fmod(t, BOX_SIZE) - BOX_SIZE / 2.f, 0.f, 0.f},
+                glm::vec3{std::sin(t) * 100.f, std::cos(t) * 100.f, 0.f});
+    }
+
+    auto supported = SimdUtils::GetSupportedLevel();
+    for (auto level : {SimdUtils::Level::SCALAR, SimdUtils::Level::SSE4, SimdUtils::Level::AVX2}) {
+      if (level > supported)
+        break;
+
+      double batchNs =
+          measure(N_RUNS, [&]() { batch.reflectInBox(BOX_SIZE / 2.f, FRAME_DT, level); });
+      Logger::info("[Microbenchmarks] {:6}: {:8.2f} ns/particle, {:.1f}M particles/frame",
+                   SimdUtils::GetLevelName(level), batchNs / N_PARTICLES,
+                   FRAME_NS / (batchNs / N_PARTICLES) / 1e6);
+    }
+  }
+} // namespace Microbenchmarks
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "Benchmarks.hpp"
+
+#include <TritiumEngine/Core/JobSystem.hpp>
+#include <TritiumEngine/Core/System.hpp>
+#include <TritiumEngine/Core/SystemPipeline.hpp>
+#include <TritiumEngine/Core/SystemScheduler.hpp>
+#include <TritiumEngine/Utilities/Logger.hpp>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace TritiumEngine::Core;
+using namespace TritiumEngine::Utilities;
+
+namespace Microbenchmarks
+{
+  namespace
+  {
+    constexpr size_t N_SYSTEMS = 64;
+    constexpr int N_FRAMES     = 100000;
+    constexpr float FRAME_DT   = 1.f / 60.f;
+
+    class CounterSystemBase : public System {
+    public:
+      float getValue() const { return m_value; }
+
+    protected:
+      float m_value = 0.f;
+    };
+
+    /** @brief Smallest useful system, so that measured time is dominated by dispatch */
+    template <size_t N> class CounterSystem : public CounterSystemBase {
+    public:
+      struct Counter {};
+
+      CounterSystem() { writes<Counter>(); }
+
+      void update(float dt) override { m_value = m_value * 0.5f + dt * (N + 1); }
+    };
+
+    template <typename Sequence> struct CounterPipeline;
+    template <size_t... Is> struct CounterPipeline<std::index_sequence<Is...>> {
+      using type = SystemPipeline<CounterSystem<Is>...>;
+
+      static void addDynamic(std::vector<std::unique_ptr<System>> &systems) {
+        (systems.emplace_back(std::make_unique<CounterSystem<Is>>()), ...);
+      }
+
+      static float sum(const type &pipeline) {
+        return (pipeline.template get<CounterSystem<Is>>().getValue() + ...);
+      }
+    };
+
+    using Counters = CounterPipeline<std::make_index_sequence<N_SYSTEMS>>;
+
+    float sumDynamic(const std::vector<std::unique_ptr<System>> &systems) {
+      float sum = 0.f;
+      for (auto &system : systems)
+        sum += static_cast<const CounterSystemBase *>(system.get())->getValue();
+      return sum;
+    }
+  } // namespace
+
+  /**
+   * @brief Compares the per-frame cost of updating many small systems through virtual calls, the
+   * dependency scheduler used by scenes and a compile-time system pipeline
+   */
+  void runSystemDispatchBenchmark() {
+    Logger::info("[Microbenchmarks] System dispatch, {} systems, {} frames", N_SYSTEMS, N_FRAMES);
+
+    // Virtual update loop over heap allocated systems
+    std::vector<std::unique_ptr<System>> dynamicSystems;
+    Counters::addDynamic(dynamicSystems);
+    double virtualNs = measure(N_FRAMES, [&]() {
+      for (auto &system : dynamicSystems)
+        system->update(FRAME_DT);
+    });
+
+    // Systems scheduled as a dependency graph on the job system, as in Scene
+    JobSystem jobSystem;
+    SystemScheduler scheduler;
+    std::vector<System *> scheduledSystems;
+    for (auto &system : dynamicSystems)
+      scheduledSystems.push_back(system.get());
+    scheduler.build(scheduledSystems);
+    double scheduledNs = measure(N_FRAMES, [&]() { scheduler.run(jobSystem, FRAME_DT); });
+
+    // Systems stored in a tuple and updated without virtual dispatch
+    Counters::type pipeline;
+    double staticNs = measure(
+        N_FRAMES, [&]() { pipeline.update(System::UpdatePhase::SIMULATION, FRAME_DT); });
+
+    // Results are logged so the updates cannot be optimised away
+    Logger::info("[Microbenchmarks] Virtual:   {:8.1f} ns/frame ({:.2f} ns/system, checksum {})",
+                 virtualNs, virtualNs / N_SYSTEMS, sumDynamic(dynamicSystems));
+    Logger::info("[Microbenchmarks] Scheduled: {:8.1f} ns/frame ({:.2f} ns/system)", scheduledNs,
+                 scheduledNs / N_SYSTEMS);
+    Logger::info("[Microbenchmarks] Static:    {:8.1f} ns/frame ({:.2f} ns/system, checksum {})",
+                 staticNs, staticNs / N_SYSTEMS, Counters::sum(pipeline));
+  }
+} // namespace Microbenchmarks
\ No newline at end of file
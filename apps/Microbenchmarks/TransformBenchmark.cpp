@@ -0,0 +1,67 @@
+#include "Benchmarks.hpp"
+
+#include <TritiumEngine/Core/Components/Transform.hpp>
+#include <TritiumEngine/Core/TransformBatch.hpp>
+#include <TritiumEngine/Utilities/Logger.hpp>
+#include <TritiumEngine/Utilities/SimdUtils.hpp>
+
+#include <vector>
+
+using namespace TritiumEngine::Core;
+using namespace TritiumEngine::Utilities;
+
+namespace Microbenchmarks
+{
+  namespace
+  {
+    constexpr size_t N_TRANSFORMS = 1000000;
+    constexpr int N_RUNS          = 20;
+
+    float checksum(const std::vector<glm::mat4> &models) {
+      float sum = 0.f;
+      for (const auto &model : models)
+        sum += model[0][0] + model[3][1];
+      return sum;
+    }
+  } // namespace
+
+  /**
+   * @brief Compares calculating model matrices one at a time with glm against the SIMD kernels of
+   * TransformBatch, for each instruction set supported by the CPU
+   */
+  void runTransformBenchmark() {
+    Logger::info("[Microbenchmarks] Model matrices, {} transforms, {} runs", N_TRANSFORMS, N_RUNS);
+
+    std::vector<Transform> transforms;
+    TransformBatch batch;
+    transforms.reserve(N_TRANSFORMS);
+    batch.reserve(N_TRANSFORMS);
+    for (size_t i = 0; i < N_TRANSFORMS; ++i) {
+      float t = static_cast<float>(i);
+      transforms.emplace_back(glm::vec3{t, t * 0.5f, 0.f}, glm::vec3{0.f, 0.f, t * 0.01f},
+                              glm::vec3{1.f + t * 1e-6f});
+      batch.push(transforms.back());
+    }
+
+    std::vector<glm::mat4> models(N_TRANSFORMS);
+    double glmNs = measure(N_RUNS, [&]() {
+      for (size_t i = 0; i < N_TRANSFORMS; ++i) {
+        transforms[i].updateModelMatrix();
+        models[i] = transforms[i].getModelMatrix();
+      }
+    });
+    Logger::info("[Microbenchmarks] glm:    {:8.2f} ns/transform (checksum {})",
+                 glmNs / N_TRANSFORMS, checksum(models));
+
+    auto supported = SimdUtils::GetSupportedLevel();
+    for (auto level : {SimdUtils::Level::SCALAR, SimdUtils::Level::SSE4, SimdUtils::Level::AVX2}) {
+      if (level > supported)
+        break;
+
+      double batchNs = measure(N_RUNS, [&]() { batch.calcModelMatrices(models.data(), level); });
+      Logger::info("[Microbenchmarks] {:6}: {:8.2f} ns/transform (checksum {}, {:.1f}x)",
+                   SimdUtils::GetLevelName(level), batchNs / N_TRANSFORMS, checksum(models),
+                   glmNs / batchNs);
+    }
+  }
+} // namespace Microbenchmarks
\ No newline at end of file
@@ -7,6 +7,7 @@ using namespace entt::literals;
 
 namespace RenderingBenchmark::Components
 {
-  using MainCameraTag = entt::tag<"mainCamera"_hs>;
-  using UiCameraTag   = entt::tag<"uiCamera"_hs>;
+  using MainCameraTag  = entt::tag<"mainCamera"_hs>;
+  using UiCameraTag    = entt::tag<"uiCamera"_hs>;
+  using GpuParticleTag = entt::tag<"gpuParticle"_hs>;
 } // namespace RenderingBenchmark::Components
\ No newline at end of file
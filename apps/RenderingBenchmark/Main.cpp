@@ -1,6 +1,8 @@
 #include "Scenes/CubeScene.hpp"
+#include "Scenes/InstanceSetsScene.hpp"
 #include "Scenes/ParticlesBoxScene.hpp"
 #include "Scenes/ParticlesCollisionsScene.hpp"
+#include "Scenes/TextLabelsScene.hpp"
 
 #include <TritiumEngine/Core/Application.hpp>
 #include <TritiumEngine/Core/ResourceManager.hpp>
@@ -23,12 +25,18 @@ static void setup(Application *app) {
                        [&sceneManager]() { sceneManager.reloadCurrentScene(); });
   input.addKeyCallback(Key::ENTER, KeyState::RELEASED,
                        [&sceneManager]() { sceneManager.nextScene(true); });
+  input.addKeyCallback(Key::F1, KeyState::RELEASED, [&sceneManager]() {
+    if (Scene *scene = sceneManager.getCurrentScene())
+      scene->logSchedule();
+  });
   input.setCloseCallback([app]() { app->stop(); });
 
   // Add scenes
   sceneManager.addScene<ParticlesBoxScene>();
   sceneManager.addScene<CubeScene>();
   sceneManager.addScene<ParticleCollisionsScene>();
+  sceneManager.addScene<InstanceSetsScene>();
+  sceneManager.addScene<TextLabelsScene>();
 }
 
 int main() {
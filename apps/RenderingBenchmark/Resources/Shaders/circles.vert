@@ -4,7 +4,12 @@ layout (location = 0) uniform vec3 pos;
 layout (location = 1) in mat4 instanceModel;
 layout (location = 5) in vec4 instanceColor;
 
-uniform mat4 projectionView;
+layout (std140) uniform CameraData
+{
+  mat4 projection;
+  mat4 view;
+  mat4 projectionView;
+};
 
 out mat4 mvp;
 out vec4 vColor;
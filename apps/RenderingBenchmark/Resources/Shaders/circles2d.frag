@@ -0,0 +1,10 @@
+#version 430 core
+
+in vec4 fColor;
+
+out vec4 FragColor;
+
+void main()
+{
+  FragColor = fColor;
+}
\ No newline at end of file
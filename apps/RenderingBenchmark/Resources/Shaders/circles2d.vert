@@ -0,0 +1,32 @@
+#version 430 core
+
+layout (location = 0) uniform vec3 pos;
+layout (location = 1) in vec2 instancePosition;
+layout (location = 2) in vec2 instanceScale;
+layout (location = 3) in float instanceRotation; // defaults to 0 when the layout has no rotation
+layout (location = 5) in vec4 instanceColor;
+
+layout (std140) uniform CameraData
+{
+  mat4 projection;
+  mat4 view;
+  mat4 projectionView;
+};
+
+out mat4 mvp;
+out vec4 vColor;
+
+void main()
+{
+  // Expand the compact 2D instance into a model matrix
+  float c = cos(instanceRotation);
+  float s = sin(instanceRotation);
+  mat4 model = mat4(vec4(c * instanceScale.x, s * instanceScale.x, 0.0, 0.0),
+                    vec4(-s * instanceScale.y, c * instanceScale.y, 0.0, 0.0),
+                    vec4(0.0, 0.0, 1.0, 0.0),
+                    vec4(instancePosition, 0.0, 1.0));
+
+  gl_Position = vec4(pos, 1.0);
+  mvp = projectionView * model;
+  vColor = instanceColor;
+}
\ No newline at end of file
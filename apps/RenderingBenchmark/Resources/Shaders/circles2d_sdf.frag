@@ -0,0 +1,17 @@
+#version 330 core
+
+out vec4 FragColor;
+
+in vec2 localPos;
+in vec4 vertexColor;
+
+void main()
+{
+  // Signed distance to the unit circle, anti-aliased over the width of one pixel
+  float dist = length(localPos) - 1.0;
+  float coverage = clamp(0.5 - dist / fwidth(dist), 0.0, 1.0);
+  if (coverage <= 0.0)
+    discard;
+
+  FragColor = vec4(vertexColor.rgb, vertexColor.a * coverage);
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#version 330 core
+
+layout (location = 0) in vec3 pos;
+layout (location = 1) in vec2 instancePosition;
+layout (location = 2) in vec2 instanceScale;
+layout (location = 5) in vec4 instanceColor;
+
+layout (std140) uniform CameraData
+{
+  mat4 projection;
+  mat4 view;
+  mat4 projectionView;
+};
+
+out vec2 localPos;
+out vec4 vertexColor;
+
+void main()
+{
+  // Circles look the same at any rotation, so the quad is never rotated
+  vec2 worldPos = pos.xy * instanceScale + instancePosition;
+
+  gl_Position = projectionView * vec4(worldPos, 0.0, 1.0);
+  localPos = pos.xy;
+  vertexColor = instanceColor;
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#version 330 core
+
+layout (location = 0) in vec3 pos;
+layout (location = 1) in mat4 instanceModel;
+layout (location = 5) in vec4 instanceColor;
+
+layout (std140) uniform CameraData
+{
+  mat4 projection;
+  mat4 view;
+  mat4 projectionView;
+};
+
+out vec2 localPos;
+out vec4 vertexColor;
+
+void main()
+{
+  // Circles look the same from any side, so the quad is expanded facing the screen
+  vec4 center = view * instanceModel[3];
+  float radius = length(instanceModel[0].xyz);
+
+  gl_Position = projection * (center + vec4(pos.xy * radius, 0.0, 0.0));
+  localPos = pos.xy;
+  vertexColor = instanceColor;
+}
\ No newline at end of file
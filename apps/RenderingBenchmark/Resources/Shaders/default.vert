@@ -3,7 +3,13 @@
 layout (location = 0) in vec3 pos;
 
 uniform mat4 model;
-uniform mat4 projectionView;
+
+layout (std140) uniform CameraData
+{
+  mat4 projection;
+  mat4 view;
+  mat4 projectionView;
+};
 
 void main()
 {
@@ -0,0 +1,35 @@
+#version 430 core
+
+layout (location = 0) in vec3 pos;
+
+struct Particle
+{
+  vec2 position;
+  vec2 velocity;
+  vec2 scale;
+  uint color;
+  uint padding;
+};
+
+layout (std430, binding = 0) readonly buffer Particles
+{
+  Particle particles[];
+};
+
+layout (std140) uniform CameraData
+{
+  mat4 projection;
+  mat4 view;
+  mat4 projectionView;
+};
+
+out vec4 vertexColor;
+
+void main()
+{
+  Particle particle = particles[gl_InstanceID];
+  vec2 worldPos     = pos.xy * particle.scale + particle.position;
+
+  gl_Position = projectionView * vec4(worldPos, pos.z, 1.0);
+  vertexColor = unpackUnorm4x8(particle.color);
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#version 330 core
+
+layout (location = 0) in vec3 pos;
+layout (location = 1) in vec2 instancePosition;
+layout (location = 2) in vec2 instanceScale;
+layout (location = 3) in float instanceRotation; // defaults to 0 when the layout has no rotation
+layout (location = 5) in vec4 instanceColor;
+
+layout (std140) uniform CameraData
+{
+  mat4 projection;
+  mat4 view;
+  mat4 projectionView;
+};
+
+out vec4 vertexColor;
+
+void main()
+{
+  float c = cos(instanceRotation);
+  float s = sin(instanceRotation);
+  vec2 worldPos = mat2(c, s, -s, c) * (pos.xy * instanceScale) + instancePosition;
+
+  gl_Position = projectionView * vec4(worldPos, pos.z, 1.0);
+  vertexColor = instanceColor;
+}
\ No newline at end of file
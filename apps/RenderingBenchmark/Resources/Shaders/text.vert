@@ -1,12 +1,14 @@
 #version 330
 
-layout(location = 0) in vec4 vertex;
+layout(location = 0) in vec4 position;
+layout(location = 1) in vec2 vertexTexCoords;
+layout(location = 2) in vec4 vertexColor;
 
 out vec2 texCoords;
-
-uniform mat4 mvp;
+out vec4 color;
 
 void main() {
-  gl_Position = mvp * vec4(vertex.xy, 0.0, 1.0);
-  texCoords = vertex.zw;
+  gl_Position = position;
+  texCoords = vertexTexCoords;
+  color = vertexColor;
 }
\ No newline at end of file
@@ -1,14 +1,12 @@
 #pragma once
 
 #include "Scenes/CubeScene.hpp"
-#include "Components/Tags.hpp"
 #include "Settings.hpp"
-#include "Systems/CubeRenderSystem.hpp"
 
 #include <TritiumEngine/Core/Application.hpp>
 #include <TritiumEngine/Core/Components/NativeScript.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
 #include <TritiumEngine/Rendering/Primitives.hpp>
-#include <TritiumEngine/Rendering/TextRendering/Systems/TextRenderSystem.hpp>
 #include <TritiumEngine/Utilities/Random/Position.hpp>
 #include <TritiumEngine/Utilities/Scripts/CameraStatsUI.hpp>
 #include <TritiumEngine/Utilities/Scripts/FpsStatsUI.hpp>
@@ -34,7 +32,8 @@ namespace
 namespace RenderingBenchmark::Scenes
 {
   CubeScene::CubeScene(const std::string &name, Application &app)
-      : Scene(name, app), m_cameraController(m_app.inputManager), m_callbacks(), m_gradient() {
+      : StaticScene(name, app), m_cameraController(m_app.inputManager), m_callbacks(),
+        m_gradient() {
     // Setup color gradient
     m_gradient.addColorPoint(COLOR_RED, 0.f);
     m_gradient.addColorPoint(COLOR_YELLOW, 0.2f);
@@ -69,9 +68,8 @@ namespace RenderingBenchmark::Scenes
     textRenderSettings.blendSFactor = GL_SRC_ALPHA;
     textRenderSettings.blendDFactor = GL_ONE_MINUS_SRC_ALPHA;
 
-    // Setup systems
-    addSystem<CubeRenderSystem<MainCameraTag::value>>(cubeRenderSettings);
-    addSystem<TextRenderSystem<UiCameraTag::value>>(textRenderSettings);
+    // Setup systems, the scene always draws with the same systems so they form a static pipeline
+    setupPipeline(cubeRenderSettings, textRenderSettings);
 
     // Setup scene camera
     auto &registry = m_app.registry;
@@ -117,7 +115,7 @@ namespace RenderingBenchmark::Scenes
   }
 
   void CubeScene::dispose() {
-    glDisable(GL_DEPTH_TEST);
+    GLState::setDepthTest(false);
     m_cameraController.dispose();
     m_app.inputManager.removeCallbacks(m_callbacks);
   }
@@ -1,7 +1,11 @@
 #pragma once
 
-#include <TritiumEngine/Core/Scene.hpp>
+#include "Components/Tags.hpp"
+#include "Systems/CubeRenderSystem.hpp"
+
+#include <TritiumEngine/Core/StaticScene.hpp>
 #include <TritiumEngine/Rendering/ColorGradient.hpp>
+#include <TritiumEngine/Rendering/TextRendering/Systems/TextRenderSystem.hpp>
 #include <TritiumEngine/Utilities/CameraController.hpp>
 
 #include <entt/entt.hpp>
@@ -12,7 +16,9 @@ using namespace TritiumEngine::Utilities;
 
 namespace RenderingBenchmark::Scenes
 {
-  class CubeScene : public Scene {
+  class CubeScene
+      : public StaticScene<Systems::CubeRenderSystem<Components::MainCameraTag::value>,
+                           TextRenderSystem<Components::UiCameraTag::value>> {
   public:
     CubeScene(const std::string &name, Application &app);
 
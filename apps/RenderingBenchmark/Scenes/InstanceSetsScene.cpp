@@ -0,0 +1,158 @@
+#include "Scenes/InstanceSetsScene.hpp"
+#include "Components/Tags.hpp"
+#include "Settings.hpp"
+#include "Systems/BoxContainerSystem.hpp"
+
+#include <TritiumEngine/Core/Components/NativeScript.hpp>
+#include <TritiumEngine/Core/Components/Rigidbody.hpp>
+#include <TritiumEngine/Core/Components/TransformHistory.hpp>
+#include <TritiumEngine/Rendering/ColorGradient.hpp>
+#include <TritiumEngine/Rendering/Mesh.hpp>
+#include <TritiumEngine/Rendering/Primitives.hpp>
+#include <TritiumEngine/Rendering/Systems/InstancedRenderSystem.hpp>
+#include <TritiumEngine/Rendering/TextRendering/Systems/TextRenderSystem.hpp>
+#include <TritiumEngine/Utilities/Random/Position.hpp>
+#include <TritiumEngine/Utilities/Scripts/FpsStatsUI.hpp>
+
+using namespace RenderingBenchmark::Components;
+using namespace RenderingBenchmark::Systems;
+using namespace RenderingBenchmark::Settings;
+using namespace TritiumEngine::Utilities;
+
+using Projection = Camera::Projection;
+
+namespace
+{
+  constexpr static float CONTAINER_SIZE      = 750.f;
+  constexpr static int NUM_PARTICLES         = 128000;
+  constexpr static glm::vec3 SHAPE_VELOCITY  = {100.f, 100.f, 0.f};
+  constexpr static glm::quat SHAPE_ROTATION  = {1.0f, 0.f, 0.f, 0.f};
+  constexpr static glm::vec3 SHAPE_SCALE     = {4.f, 4.f, 1.f};
+  constexpr static float DISPLACEMENT_RADIUS = 300.f;
+} // namespace
+
+namespace RenderingBenchmark::Scenes
+{
+  InstanceSetsScene::InstanceSetsScene(const std::string &name, Application &app)
+      : Scene(name, app), m_nSets(128), m_callbacks() {}
+
+  void InstanceSetsScene::init() {
+    // Setup render settings
+    RenderSettings textRenderSettings;
+    textRenderSettings.enableBlend  = true;
+    textRenderSettings.blendSFactor = GL_SRC_ALPHA;
+    textRenderSettings.blendDFactor = GL_ONE_MINUS_SRC_ALPHA;
+
+    // Setup systems
+    addSystem<InstancedRenderSystem<MainCameraTag::value>>();
+    addSystem<TextRenderSystem<UiCameraTag::value>>(textRenderSettings);
+    addSystem<BoxContainerSystem>(CONTAINER_SIZE);
+
+    auto &registry = m_app.registry;
+    auto &input    = m_app.inputManager;
+
+    // Setup cameras
+    float aspect      = m_app.window.getFrameAspect();
+    float camWidth    = VERTICAL_SCREEN_UNITS * aspect;
+    float camHeight   = VERTICAL_SCREEN_UNITS;
+    const auto camPos = glm::vec3{0.f, 0.f, 1.f};
+
+    auto mainCamera = registry.create();
+    registry.emplace<Camera>(mainCamera, Projection::ORTHOGRAPHIC, camWidth, camHeight, camPos);
+    registry.emplace<MainCameraTag>(mainCamera);
+
+    auto uiCamera = registry.create();
+    registry.emplace<Camera>(uiCamera, Projection::ORTHOGRAPHIC, camWidth, camHeight, camPos);
+    registry.emplace<UiCameraTag>(uiCamera);
+
+    // Setup UI
+    m_titleText = addText(std::format("{} instance sets, {} particles", m_nSets, NUM_PARTICLES),
+                          {0.f, 0.82f}, 0.6f, Text::Alignment::BOTTOM_CENTER);
+
+    // Help panel
+    addText("Controls:            ", {-0.97f, 0.75f}, 0.6f, Text::Alignment::TOP_LEFT);
+    addText("1: 1 instance set    ", {-0.95f, 0.6f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("2: 16 instance sets  ", {-0.95f, 0.5f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("3: 128 instance sets ", {-0.95f, 0.4f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("4: 512 instance sets ", {-0.95f, 0.3f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("F: Toggle FPS display", {-0.95f, 0.15f}, 0.5f, Text::Alignment::TOP_LEFT);
+
+    // Fps stats
+    auto fpsStatsUI = registry.create();
+    auto &script = registry.emplace<NativeScript>(fpsStatsUI, std::make_unique<FpsStatsUI>(m_app));
+    script.getInstance().setEnabled(false);
+
+    // Controls - instance set counts
+    m_callbacks[0] =
+        input.addKeyCallback(Key::NUM_1, KeyState::RELEASED, [this]() { setInstanceSetCount(1); });
+    m_callbacks[1] =
+        input.addKeyCallback(Key::NUM_2, KeyState::RELEASED, [this]() { setInstanceSetCount(16); });
+    m_callbacks[2] = input.addKeyCallback(Key::NUM_3, KeyState::RELEASED,
+                                          [this]() { setInstanceSetCount(128); });
+    m_callbacks[3] = input.addKeyCallback(Key::NUM_4, KeyState::RELEASED,
+                                          [this]() { setInstanceSetCount(512); });
+
+    // FPS display toggle
+    m_callbacks[4] = input.addKeyCallback(Key::F, KeyState::RELEASED, [&registry, fpsStatsUI]() {
+      registry.get<NativeScript>(fpsStatsUI).getInstance().toggleEnabled();
+    });
+
+    generateInstanceSets();
+  }
+
+  void InstanceSetsScene::dispose() { m_app.inputManager.removeCallbacks(m_callbacks); }
+
+  void InstanceSetsScene::setInstanceSetCount(int nSets) {
+    m_nSets = nSets;
+    m_app.sceneManager.reloadCurrentScene();
+  }
+
+  void InstanceSetsScene::generateInstanceSets() {
+    auto &registry      = m_app.registry;
+    auto &shaderManager = m_app.shaderManager;
+
+    // Give each instance set a distinct starting color
+    ColorGradient gradient;
+    gradient.addColorPoint(COLOR_RED, 0.f);
+    gradient.addColorPoint(COLOR_YELLOW, 0.5f);
+    gradient.addColorPoint(COLOR_CYAN, 1.f);
+
+    // Particles are split evenly between all instance sets
+    int nParticlesPerSet = NUM_PARTICLES / m_nSets;
+
+    // All instance sets share a single quad mesh
+    auto quadMesh = Mesh::get("quad", Primitives::createQuad());
+
+    for (int set = 0; set < m_nSets; ++set) {
+      auto entity      = registry.create();
+      auto &renderable =
+          registry.emplace<InstancedRenderable>(entity, GL_TRIANGLES, quadMesh, nParticlesPerSet);
+      registry.emplace<Shader>(entity, shaderManager.get("instanced"));
+
+      Color color = gradient.getColor(static_cast<float>(set) / m_nSets);
+      for (int i = 0; i < nParticlesPerSet; ++i) {
+        auto instancedEntity = registry.create();
+        registry.emplace<InstanceTag>(instancedEntity, renderable.getInstanceId());
+        auto &transform = registry.emplace<Transform>(
+            instancedEntity, Random::RadialPosition(DISPLACEMENT_RADIUS, true), SHAPE_ROTATION,
+            SHAPE_SCALE);
+        registry.emplace<TransformHistory>(instancedEntity, transform);
+        registry.emplace<Color>(instancedEntity, color);
+        registry.emplace<Rigidbody>(instancedEntity, SHAPE_VELOCITY);
+      }
+    }
+  }
+
+  entt::entity InstanceSetsScene::addText(const std::string &text, const glm::vec2 &position,
+                                          float scaleFactor, Text::Alignment alignment) {
+    auto &registry      = m_app.registry;
+    auto &shaderManager = m_app.shaderManager;
+
+    auto entity = registry.create();
+    registry.emplace<Text>(entity, text, "Hack-Regular", scaleFactor, alignment);
+    registry.emplace<Transform>(entity, glm::vec3{position.x, position.y, 0.1f});
+    registry.emplace<Shader>(entity, shaderManager.get("text"));
+    registry.emplace<Color>(entity, COLOR_GREEN);
+    return entity;
+  }
+} // namespace RenderingBenchmark::Scenes
\ No newline at end of file
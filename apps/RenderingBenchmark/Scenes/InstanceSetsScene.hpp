@@ -0,0 +1,43 @@
+#pragma once
+
+#include <TritiumEngine/Core/Scene.hpp>
+#include <TritiumEngine/Input/InputManager.hpp>
+#include <TritiumEngine/Rendering/TextRendering/Components/Text.hpp>
+
+#include <entt/entity/entity.hpp>
+#include <glm/glm.hpp>
+
+using namespace TritiumEngine::Core;
+using namespace TritiumEngine::Input;
+using namespace TritiumEngine::Rendering;
+
+namespace TritiumEngine::Core
+{
+  class Application;
+}
+
+namespace RenderingBenchmark::Scenes
+{
+  using Application = TritiumEngine::Core::Application;
+
+  class InstanceSetsScene : public Scene {
+  public:
+    InstanceSetsScene(const std::string &name, Application &app);
+
+  protected:
+    void init() override;
+    void dispose() override;
+
+  private:
+    void setInstanceSetCount(int nSets);
+    void generateInstanceSets();
+
+    entt::entity addText(const std::string &text, const glm::vec2 &position, float scaleFactor,
+                         Text::Alignment alignment);
+
+    int m_nSets;
+    entt::entity m_titleText = entt::null;
+
+    CallbackId m_callbacks[5];
+  };
+} // namespace RenderingBenchmark::Scenes
\ No newline at end of file
@@ -4,9 +4,13 @@
 #include "Components/Tags.hpp"
 #include "Settings.hpp"
 #include "Systems/BoxContainerSystem.hpp"
+#include "Systems/GpuParticleSimulationSystem.hpp"
+#include "Systems/GpuParticleSystem.hpp"
 
 #include <TritiumEngine/Core/Components/NativeScript.hpp>
 #include <TritiumEngine/Core/Components/Rigidbody.hpp>
+#include <TritiumEngine/Core/Components/TransformHistory.hpp>
+#include <TritiumEngine/Rendering/Mesh.hpp>
 #include <TritiumEngine/Rendering/Primitives.hpp>
 #include <TritiumEngine/Rendering/Systems/InstancedRenderSystem.hpp>
 #include <TritiumEngine/Rendering/Systems/StandardRenderSystem.hpp>
@@ -38,6 +42,7 @@ namespace RenderingBenchmark::Scenes
 {
   ParticlesBoxScene::ParticlesBoxScene(const std::string &name, Application &app)
       : Scene(name, app), m_renderType(RenderType::Default), m_nParticles(1000),
+        m_persistentUploads(false), m_instanceLayout(InstanceLayout::MAT4),
         m_cameraController(app.inputManager), m_callbacks() {
     // Setup camera controller
     m_cameraController.mapKey(Key::LEFT, CameraAction::MOVE_LEFT);
@@ -65,10 +70,25 @@ namespace RenderingBenchmark::Scenes
     addSystem<StandardRenderSystem<MainCameraTag::value>>(entityRenderSettings);
     addSystem<InstancedRenderSystem<MainCameraTag::value>>(entityRenderSettings);
     addSystem<TextRenderSystem<UiCameraTag::value>>(textRenderSettings);
-    addSystem<BoxContainerSystem>(CONTAINER_SIZE);
 
-    auto &registry = m_app.registry;
-    auto &input    = m_app.inputManager;
+    // GPU simulated particles never touch the CPU integration, but step at the same fixed rate
+    if (m_renderType == RenderType::GpuSimulation) {
+      auto simulation = addSystem<GpuParticleSimulationSystem>(CONTAINER_SIZE);
+      addSystem<GpuParticleSystem<MainCameraTag::value>>(
+          entityRenderSettings, Mesh::get("quad", Primitives::createQuad()), simulation);
+    } else {
+      addSystem<BoxContainerSystem>(CONTAINER_SIZE);
+    }
+
+    auto &registry      = m_app.registry;
+    auto &input         = m_app.inputManager;
+    auto &shaderManager = m_app.shaderManager;
+
+    // Batch default rendered particles into instanced draws
+    if (m_renderType == RenderType::AutoInstanced) {
+      getSystem<StandardRenderSystem<MainCameraTag::value>>()->enableAutoInstancing(
+          shaderManager.get("default"), shaderManager.get("instanced"));
+    }
 
     // Setup cameras
     float aspect      = m_app.window.getFrameAspect();
@@ -91,17 +111,22 @@ namespace RenderingBenchmark::Scenes
 
     // Help panel
     addText("Controls:            ", {-0.97f, 0.75f}, 0.6f, Text::Alignment::TOP_LEFT);
-    addText("D: Default rendering ", {-0.95f, 0.6f}, 0.5f, Text::Alignment::TOP_LEFT);
-    addText("I: Instancing        ", {-0.95f, 0.5f}, 0.5f, Text::Alignment::TOP_LEFT);
-    addText("G: Geometry shader   ", {-0.95f, 0.4f}, 0.5f, Text::Alignment::TOP_LEFT);
-    addText("1: 1 particle        ", {-0.95f, 0.25f}, 0.5f, Text::Alignment::TOP_LEFT);
-    addText("2: 10 particles      ", {-0.95f, 0.15f}, 0.5f, Text::Alignment::TOP_LEFT);
-    addText("3: 100 particles     ", {-0.95f, 0.05f}, 0.5f, Text::Alignment::TOP_LEFT);
-    addText("4: 1000 particles    ", {-0.95f, -0.05f}, 0.5f, Text::Alignment::TOP_LEFT);
-    addText("5: 10000 particles   ", {-0.95f, -0.15f}, 0.5f, Text::Alignment::TOP_LEFT);
-    addText("6: 100000 particles  ", {-0.95f, -0.25f}, 0.5f, Text::Alignment::TOP_LEFT);
-    addText("7: 1000000 particles ", {-0.95f, -0.35f}, 0.5f, Text::Alignment::TOP_LEFT);
-    addText("F: Toggle FPS display", {-0.95f, -0.5f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("D: Default rendering ", {-0.95f, 0.65f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("I: Instancing        ", {-0.95f, 0.55f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("G: Geometry shader   ", {-0.95f, 0.45f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("A: Auto instancing   ", {-0.95f, 0.35f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("S: GPU simulation    ", {-0.95f, 0.25f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("1: 1 particle        ", {-0.95f, 0.1f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("2: 10 particles      ", {-0.95f, 0.0f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("3: 100 particles     ", {-0.95f, -0.1f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("4: 1000 particles    ", {-0.95f, -0.2f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("5: 10000 particles   ", {-0.95f, -0.3f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("6: 100000 particles  ", {-0.95f, -0.4f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("7: 1000000 particles ", {-0.95f, -0.5f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("F: Toggle FPS display", {-0.95f, -0.65f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("P: Persistent uploads", {-0.95f, -0.75f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("L: Instance layout   ", {-0.95f, -0.85f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("R: Read back GPU data", {-0.95f, -0.95f}, 0.5f, Text::Alignment::TOP_LEFT);
 
     // Fps stats
     auto fpsStatsUI = registry.create();
@@ -115,28 +140,44 @@ namespace RenderingBenchmark::Scenes
                                           [this]() { setRenderType(RenderType::Instanced); });
     m_callbacks[2] = input.addKeyCallback(Key::G, KeyState::RELEASED,
                                           [this]() { setRenderType(RenderType::Geometry); });
+    m_callbacks[3] = input.addKeyCallback(Key::A, KeyState::RELEASED,
+                                          [this]() { setRenderType(RenderType::AutoInstanced); });
+    m_callbacks[14] = input.addKeyCallback(
+        Key::S, KeyState::RELEASED, [this]() { setRenderType(RenderType::GpuSimulation); });
 
     // Controls - particle counts
-    m_callbacks[3] =
-        input.addKeyCallback(Key::NUM_1, KeyState::RELEASED, [this]() { setParticleCount(1); });
     m_callbacks[4] =
-        input.addKeyCallback(Key::NUM_2, KeyState::RELEASED, [this]() { setParticleCount(10); });
+        input.addKeyCallback(Key::NUM_1, KeyState::RELEASED, [this]() { setParticleCount(1); });
     m_callbacks[5] =
-        input.addKeyCallback(Key::NUM_3, KeyState::RELEASED, [this]() { setParticleCount(100); });
+        input.addKeyCallback(Key::NUM_2, KeyState::RELEASED, [this]() { setParticleCount(10); });
     m_callbacks[6] =
-        input.addKeyCallback(Key::NUM_4, KeyState::RELEASED, [this]() { setParticleCount(1000); });
+        input.addKeyCallback(Key::NUM_3, KeyState::RELEASED, [this]() { setParticleCount(100); });
     m_callbacks[7] =
+        input.addKeyCallback(Key::NUM_4, KeyState::RELEASED, [this]() { setParticleCount(1000); });
+    m_callbacks[8] =
         input.addKeyCallback(Key::NUM_5, KeyState::RELEASED, [this]() { setParticleCount(10000); });
-    m_callbacks[8] = input.addKeyCallback(Key::NUM_6, KeyState::RELEASED,
+    m_callbacks[9] = input.addKeyCallback(Key::NUM_6, KeyState::RELEASED,
                                           [this]() { setParticleCount(100000); });
-    m_callbacks[9] = input.addKeyCallback(Key::NUM_7, KeyState::RELEASED,
+    m_callbacks[10] = input.addKeyCallback(Key::NUM_7, KeyState::RELEASED,
                                           [this]() { setParticleCount(1000000); });
 
     // FPS display toggle
-    m_callbacks[10] = input.addKeyCallback(Key::F, KeyState::RELEASED, [&registry, fpsStatsUI]() {
+    m_callbacks[11] = input.addKeyCallback(Key::F, KeyState::RELEASED, [&registry, fpsStatsUI]() {
       registry.get<NativeScript>(fpsStatsUI).getInstance().toggleEnabled();
     });
 
+    // Instance data upload mode toggle
+    m_callbacks[12] =
+        input.addKeyCallback(Key::P, KeyState::RELEASED, [this]() { togglePersistentUploads(); });
+
+    // Instance data layout cycle
+    m_callbacks[13] =
+        input.addKeyCallback(Key::L, KeyState::RELEASED, [this]() { cycleInstanceLayout(); });
+
+    // GPU particle state readback
+    m_callbacks[15] =
+        input.addKeyCallback(Key::R, KeyState::RELEASED, [this]() { readbackGpuParticles(); });
+
     // Setup environment
     setupContainer();
     setupParticles();
@@ -168,13 +209,26 @@ namespace RenderingBenchmark::Scenes
       generateParticlesDefault();
       break;
     case RenderType::Instanced:
-      registry.get<Text>(m_titleText).text = std::format("Instanced, {} particles", m_nParticles);
+      registry.get<Text>(m_titleText).text = std::format(
+          "Instanced ({}, {} bytes/instance), {} particles",
+          m_persistentUploads ? "persistent" : "staged",
+          InstancedRenderable::getLayoutSize(m_instanceLayout), m_nParticles);
       generateParticlesInstanced();
       break;
+    case RenderType::AutoInstanced:
+      registry.get<Text>(m_titleText).text =
+          std::format("Auto instanced, {} particles", m_nParticles);
+      generateParticlesDefault();
+      break;
     case RenderType::Geometry:
       registry.get<Text>(m_titleText).text = std::format("Geometry, {} particles", m_nParticles);
       generateParticlesGeometry();
       break;
+    case RenderType::GpuSimulation:
+      registry.get<Text>(m_titleText).text =
+          std::format("GPU simulation, {} particles", m_nParticles);
+      generateParticlesGpu();
+      break;
     }
   }
 
@@ -188,6 +242,31 @@ namespace RenderingBenchmark::Scenes
     m_app.sceneManager.reloadCurrentScene();
   }
 
+  void ParticlesBoxScene::togglePersistentUploads() {
+    m_persistentUploads = !m_persistentUploads;
+    m_app.sceneManager.reloadCurrentScene();
+  }
+
+  void ParticlesBoxScene::cycleInstanceLayout() {
+    switch (m_instanceLayout) {
+    case InstanceLayout::MAT4:
+      m_instanceLayout = InstanceLayout::COMPACT_2D;
+      break;
+    case InstanceLayout::COMPACT_2D:
+      m_instanceLayout = InstanceLayout::COMPACT_2D_HALF;
+      break;
+    case InstanceLayout::COMPACT_2D_HALF:
+      m_instanceLayout = InstanceLayout::MAT4;
+      break;
+    }
+    m_app.sceneManager.reloadCurrentScene();
+  }
+
+  void ParticlesBoxScene::readbackGpuParticles() {
+    if (auto *gpuSimulation = getSystem<GpuParticleSimulationSystem>())
+      gpuSimulation->readback();
+  }
+
   entt::entity ParticlesBoxScene::addText(const std::string &text, const glm::vec2 &position,
                                           float scaleFactor, Text::Alignment alignment) {
     auto &registry      = m_app.registry;
@@ -216,11 +295,15 @@ namespace RenderingBenchmark::Scenes
     auto &registry      = m_app.registry;
     auto &shaderManager = m_app.shaderManager;
 
+    // All particles share a single quad mesh
+    auto quadMesh = Mesh::get("quad", Primitives::createQuad());
+
     for (int i = 0; i < m_nParticles; ++i) {
       auto entity = registry.create();
-      registry.emplace<Transform>(entity, Random::RadialPosition(DISPLACEMENT_RADIUS, true),
-                                  SHAPE_ROTATION, SHAPE_SCALE);
-      registry.emplace<Renderable>(entity, GL_TRIANGLES, Primitives::createQuad());
+      auto &transform = registry.emplace<Transform>(
+          entity, Random::RadialPosition(DISPLACEMENT_RADIUS, true), SHAPE_ROTATION, SHAPE_SCALE);
+      registry.emplace<TransformHistory>(entity, transform);
+      registry.emplace<Renderable>(entity, GL_TRIANGLES, quadMesh);
       registry.emplace<Shader>(entity, shaderManager.get("default"));
       registry.emplace<Color>(entity, COLOR_RED);
       registry.emplace<Rigidbody>(entity, SHAPE_VELOCITY);
@@ -233,17 +316,23 @@ namespace RenderingBenchmark::Scenes
 
     // Create instanced renderable template
     auto entity      = registry.create();
-    auto &renderable = registry.emplace<InstancedRenderable>(
-        entity, GL_TRIANGLES, Primitives::createQuad(), m_nParticles);
-    registry.emplace<Shader>(entity, shaderManager.get("instanced"));
+    auto quadMesh    = Mesh::get("quad", Primitives::createQuad());
+    auto uploadMode  = m_persistentUploads ? InstancedRenderable::UploadMode::PERSISTENT
+                                           : InstancedRenderable::UploadMode::STAGED;
+    auto &renderable = registry.emplace<InstancedRenderable>(entity, GL_TRIANGLES, quadMesh,
+                                                             m_nParticles, uploadMode,
+                                                             m_instanceLayout);
+    auto shaderName  = m_instanceLayout == InstanceLayout::MAT4 ? "instanced" : "instanced2d";
+    registry.emplace<Shader>(entity, shaderManager.get(shaderName));
 
     // Add instances
     for (int i = 0; i < m_nParticles; ++i) {
       auto instancedEntity = registry.create();
       registry.emplace<InstanceTag>(instancedEntity, renderable.getInstanceId());
-      registry.emplace<Transform>(instancedEntity,
-                                  Random::RadialPosition(DISPLACEMENT_RADIUS, true), SHAPE_ROTATION,
-                                  SHAPE_SCALE);
+      auto &transform = registry.emplace<Transform>(
+          instancedEntity, Random::RadialPosition(DISPLACEMENT_RADIUS, true), SHAPE_ROTATION,
+          SHAPE_SCALE);
+      registry.emplace<TransformHistory>(instancedEntity, transform);
       registry.emplace<Color>(instancedEntity, COLOR_RED);
       registry.emplace<Rigidbody>(instancedEntity, SHAPE_VELOCITY);
     }
@@ -263,11 +352,26 @@ namespace RenderingBenchmark::Scenes
     for (int i = 0; i < m_nParticles; ++i) {
       auto instancedEntity = registry.create();
       registry.emplace<InstanceTag>(instancedEntity, renderable.getInstanceId());
-      registry.emplace<Transform>(instancedEntity,
-                                  Random::RadialPosition(DISPLACEMENT_RADIUS, true), SHAPE_ROTATION,
-                                  SHAPE_SCALE);
+      auto &transform = registry.emplace<Transform>(
+          instancedEntity, Random::RadialPosition(DISPLACEMENT_RADIUS, true), SHAPE_ROTATION,
+          SHAPE_SCALE);
+      registry.emplace<TransformHistory>(instancedEntity, transform);
       registry.emplace<Color>(instancedEntity, COLOR_RED);
       registry.emplace<Rigidbody>(instancedEntity, SHAPE_VELOCITY);
     }
   }
+
+  void ParticlesBoxScene::generateParticlesGpu() {
+    auto &registry = m_app.registry;
+
+    // Only the initial state, GpuParticleSimulationSystem owns the particles once uploaded
+    for (int i = 0; i < m_nParticles; ++i) {
+      auto entity = registry.create();
+      registry.emplace<GpuParticleTag>(entity);
+      registry.emplace<Transform>(entity, Random::RadialPosition(DISPLACEMENT_RADIUS, true),
+                                  SHAPE_ROTATION, SHAPE_SCALE);
+      registry.emplace<Color>(entity, COLOR_RED);
+      registry.emplace<Rigidbody>(entity, SHAPE_VELOCITY);
+    }
+  }
 } // namespace RenderingBenchmark::Scenes
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <TritiumEngine/Core/Scene.hpp>
 #include <TritiumEngine/Input/InputManager.hpp>
+#include <TritiumEngine/Rendering/Components/InstancedRenderable.hpp>
 #include <TritiumEngine/Rendering/TextRendering/Components/Text.hpp>
 #include <TritiumEngine/Utilities/CameraController.hpp>
 
@@ -23,7 +24,7 @@ namespace RenderingBenchmark::Scenes
 
   class ParticlesBoxScene : public Scene {
   public:
-    enum class RenderType { Default, Instanced, Geometry };
+    enum class RenderType { Default, Instanced, Geometry, AutoInstanced, GpuSimulation };
 
     ParticlesBoxScene(const std::string &name, Application &app);
 
@@ -37,6 +38,9 @@ namespace RenderingBenchmark::Scenes
 
     void setRenderType(RenderType renderType);
     void setParticleCount(int nParticles);
+    void togglePersistentUploads();
+    void cycleInstanceLayout();
+    void readbackGpuParticles();
 
     entt::entity addText(const std::string &text, const glm::vec2 &position, float scaleFactor,
                          Text::Alignment alignment);
@@ -44,12 +48,15 @@ namespace RenderingBenchmark::Scenes
     void generateParticlesDefault();
     void generateParticlesInstanced();
     void generateParticlesGeometry();
+    void generateParticlesGpu();
 
     RenderType m_renderType;
     int m_nParticles;
+    bool m_persistentUploads;
+    InstanceLayout m_instanceLayout;
     entt::entity m_titleText = entt::null;
 
     CameraController m_cameraController;
-    CallbackId m_callbacks[11];
+    CallbackId m_callbacks[16];
   };
 } // namespace RenderingBenchmark::Scenes
\ No newline at end of file
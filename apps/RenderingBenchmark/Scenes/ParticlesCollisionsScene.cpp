@@ -5,11 +5,15 @@
 
 #include <TritiumEngine/Core/Components/NativeScript.hpp>
 #include <TritiumEngine/Core/Components/Rigidbody.hpp>
+#include <TritiumEngine/Core/Components/TransformHistory.hpp>
 #include <TritiumEngine/Physics/Components/AABB.hpp>
+#include <TritiumEngine/Physics/Systems/CollisionSystem.hpp>
 #include <TritiumEngine/Rendering/ColorGradient.hpp>
 #include <TritiumEngine/Rendering/Components/Camera.hpp>
+#include <TritiumEngine/Rendering/Components/LodPolicy.hpp>
 #include <TritiumEngine/Rendering/Primitives.hpp>
 #include <TritiumEngine/Rendering/Systems/InstancedRenderSystem.hpp>
+#include <TritiumEngine/Rendering/Systems/LodSystem.hpp>
 #include <TritiumEngine/Rendering/Systems/StandardRenderSystem.hpp>
 #include <TritiumEngine/Rendering/TextRendering/Systems/TextRenderSystem.hpp>
 #include <TritiumEngine/Utilities/Random/GridDistribution.hpp>
@@ -30,23 +34,37 @@ namespace
   constexpr static glm::quat PARTICLE_ROTATION  = {1.f, 0.f, 0.f, 0.f};
   constexpr static float PARTICLE_SCALE         = 6.f;
   constexpr static float PARTICLE_VELOCITY      = 20.f;
+  constexpr static float COLLISION_CELL_SIZE    = 4.f * PARTICLE_SCALE;
+  constexpr static float RENDER_CHUNK_SIZE      = 500.f;
+  constexpr static float TARGET_FRAME_MS        = 1000.f / 60.f;
+  constexpr static float IMPOSTOR_SIZE          = 1.f; // Pixels below which circles are splatted
+  constexpr static float STATS_UPDATE_DELAY     = 0.2f;
   constexpr static float GRID_SIZE_X            = 30000.f;
   constexpr static float GRID_SIZE_Y            = 30000.f;
-  constexpr static size_t NUM_GRID_COLS         = 1000;
-  constexpr static size_t NUM_GRID_ROWS         = 1000;
-
-  constexpr static int NUM_PARTICLES        = static_cast<int>(NUM_GRID_COLS * NUM_GRID_COLS);
-  constexpr static float GRID_CELL_WIDTH    = GRID_SIZE_X / static_cast<float>(NUM_GRID_COLS);
-  constexpr static float GRID_CELL_HEIGHT   = GRID_SIZE_Y / static_cast<float>(NUM_GRID_ROWS);
-  constexpr static float GRID_MIN_DIMENSION = std::min(GRID_CELL_WIDTH, GRID_CELL_HEIGHT);
-  constexpr static float DISPLACEMENT =
-      ((GRID_MIN_DIMENSION - 2 * PARTICLE_SCALE) / GRID_MIN_DIMENSION) - 0.005f;
+
+  // Square particle grids of roughly 10k, 100k and 1M particles
+  constexpr static size_t GRID_COLS_10K  = 100;
+  constexpr static size_t GRID_COLS_100K = 316;
+  constexpr static size_t GRID_COLS_1M   = 1000;
+
+  const char *getCirclePathName(CirclePath circlePath) {
+    switch (circlePath) {
+    case CirclePath::GEOMETRY:
+      return "Geometry shader";
+    case CirclePath::SDF_QUADS:
+      return "SDF quads";
+    case CirclePath::POINTS:
+      return "Points";
+    }
+    return "";
+  }
 } // namespace
 
 namespace RenderingBenchmark::Scenes
 {
   ParticleCollisionsScene::ParticleCollisionsScene(const std::string &name, Application &app)
-      : Scene(name, app), m_fpsDisplayCallback(), m_cameraController(app.inputManager) {
+      : Scene(name, app), m_circlePath(CirclePath::GEOMETRY), m_nGridCols(GRID_COLS_1M),
+        m_useImpostors(true), m_cameraController(app.inputManager), m_callbacks() {
     // Setup camera controller
     m_cameraController.mapKey(Key::LEFT, CameraAction::MOVE_LEFT);
     m_cameraController.mapKey(Key::RIGHT, CameraAction::MOVE_RIGHT);
@@ -60,16 +78,31 @@ namespace RenderingBenchmark::Scenes
   }
 
   void ParticleCollisionsScene::init() {
-    // Setup render settings
-    RenderSettings textRenderSettings;
-    textRenderSettings.enableBlend  = true;
-    textRenderSettings.blendSFactor = GL_SRC_ALPHA;
-    textRenderSettings.blendDFactor = GL_ONE_MINUS_SRC_ALPHA;
+    // Setup grid of particles, the cells shrink as the particle count grows
+    int nParticles         = static_cast<int>(m_nGridCols * m_nGridCols);
+    float gridCellWidth    = GRID_SIZE_X / static_cast<float>(m_nGridCols);
+    float gridCellHeight   = GRID_SIZE_Y / static_cast<float>(m_nGridCols);
+    float gridMinDimension = std::min(gridCellWidth, gridCellHeight);
+    float displacement =
+        ((gridMinDimension - 2 * PARTICLE_SCALE) / gridMinDimension) - 0.005f;
+
+    // Setup render settings, anti-aliased circle edges are blended
+    RenderSettings blendRenderSettings;
+    blendRenderSettings.enableBlend  = true;
+    blendRenderSettings.blendSFactor = GL_SRC_ALPHA;
+    blendRenderSettings.blendDFactor = GL_ONE_MINUS_SRC_ALPHA;
 
     // Setup systems
+    addSystem<LodSystem>();
     addSystem<StandardRenderSystem<MainCameraTag::value>>();
-    addSystem<CirclesRenderSystem<MainCameraTag::value>>(RenderSettings{}, 8000, 80000);
-    addSystem<TextRenderSystem<UiCameraTag::value>>(textRenderSettings);
+    auto circlesSystem = addSystem<CirclesRenderSystem<MainCameraTag::value>>(
+        blendRenderSettings, 8000, 80000, RENDER_CHUNK_SIZE);
+    getSystem(circlesSystem)->setCirclePath(m_circlePath);
+    getSystem(circlesSystem)->setImpostorSize(m_useImpostors ? IMPOSTOR_SIZE : 0.f);
+    addSystem<TextRenderSystem<UiCameraTag::value>>(blendRenderSettings);
+    m_collisionSystem = addSystem<CollisionSystem>(glm::vec2{-GRID_SIZE_X, -GRID_SIZE_Y} * 0.5f,
+                                                   glm::vec2{GRID_SIZE_X, GRID_SIZE_Y} * 0.5f,
+                                                   COLLISION_CELL_SIZE);
 
     auto &registry      = m_app.registry;
     auto &window        = m_app.window;
@@ -98,11 +131,46 @@ namespace RenderingBenchmark::Scenes
         registry.emplace<NativeScript>(fpsStatsUI, std::make_unique<FpsStatsUI>(m_app));
     fpsStatsScript.getInstance().setEnabled(false);
 
+    m_collisionStatsText = registry.create();
+    registry.emplace<Text>(m_collisionStatsText, "Collisions:", "Hack-Regular", 0.43f,
+                           Text::Alignment::TOP_LEFT);
+    registry.emplace<Transform>(m_collisionStatsText, glm::vec3{-0.98f, 0.78f, 0.f});
+    registry.emplace<Shader>(m_collisionStatsText, shaderManager.get("text"));
+    registry.emplace<Color>(m_collisionStatsText, COLOR_GREEN);
+
+    m_benchmarkText = registry.create();
+    registry.emplace<Text>(
+        m_benchmarkText,
+        std::format("Circles: {}, {} particles, impostors {} (C: path, I: impostors, "
+                    "1/2/3: 10k/100k/1M)",
+                    getCirclePathName(m_circlePath), nParticles, m_useImpostors ? "on" : "off"),
+        "Hack-Regular", 0.43f, Text::Alignment::TOP_LEFT);
+    registry.emplace<Transform>(m_benchmarkText, glm::vec3{-0.98f, 0.73f, 0.f});
+    registry.emplace<Shader>(m_benchmarkText, shaderManager.get("text"));
+    registry.emplace<Color>(m_benchmarkText, COLOR_GREEN);
+
     // Setup controls
-    m_fpsDisplayCallback = input.addKeyCallback(Key::F, KeyState::RELEASED, [&fpsStatsScript]() {
+    m_callbacks[0] = input.addKeyCallback(Key::F, KeyState::RELEASED, [&fpsStatsScript]() {
       fpsStatsScript.getInstance().toggleEnabled();
     });
 
+    // Circle path cycle
+    m_callbacks[1] = input.addKeyCallback(Key::C, KeyState::RELEASED, [this]() {
+      setCirclePath(static_cast<CirclePath>((static_cast<int>(m_circlePath) + 1) % 3));
+    });
+
+    // Density impostor toggle
+    m_callbacks[5] =
+        input.addKeyCallback(Key::I, KeyState::RELEASED, [this]() { toggleImpostors(); });
+
+    // Controls - particle counts
+    m_callbacks[2] = input.addKeyCallback(Key::NUM_1, KeyState::RELEASED,
+                                          [this]() { setParticleCount(GRID_COLS_10K); });
+    m_callbacks[3] = input.addKeyCallback(Key::NUM_2, KeyState::RELEASED,
+                                          [this]() { setParticleCount(GRID_COLS_100K); });
+    m_callbacks[4] = input.addKeyCallback(Key::NUM_3, KeyState::RELEASED,
+                                          [this]() { setParticleCount(GRID_COLS_1M); });
+
     // Create background quad particle container
     auto backgroundQuad = registry.create();
     registry.emplace<Renderable>(backgroundQuad, GL_TRIANGLES,
@@ -116,27 +184,68 @@ namespace RenderingBenchmark::Scenes
     gradient.addColorPoint(COLOR_RED, 0.f);
     gradient.addColorPoint(COLOR_MAGENTA, 1.f);
 
-    // Create instanced renderable template for particles
+    // Create instanced renderable template for particles, which are unrotated 2D circles and only
+    // need the smallest instance layout. Distance field circles are drawn on quads spanning the
+    // unit circle, the other paths start from points
+    bool isSdf            = m_circlePath == CirclePath::SDF_QUADS;
     auto particleTemplate = registry.create();
     auto &renderable      = registry.emplace<InstancedRenderable>(
-        particleTemplate, GL_POINTS, Primitives::createPoint2d(), NUM_PARTICLES);
+        particleTemplate, isSdf ? GL_TRIANGLES : GL_POINTS,
+        isSdf ? Primitives::createQuad(2.f, 2.f) : Primitives::createPoint2d(), nParticles,
+        InstancedRenderable::UploadMode::STAGED, InstanceLayout::COMPACT_2D_HALF);
+
+    // Circle detail is lowered whenever frames take longer than the target
+    using CirclesRenderer = CirclesRenderSystem<MainCameraTag::value>;
+    registry.emplace<LodPolicy>(particleTemplate, "circles", CirclesRenderer::NUM_LOD_LEVELS,
+                                TARGET_FRAME_MS);
 
     // Create particles in random grid distribtion pattern
-    Random::GridDistribution dist{NUM_GRID_COLS, NUM_GRID_COLS, GRID_CELL_WIDTH, GRID_CELL_HEIGHT,
-                                  DISPLACEMENT};
-    for (int i = 0; i < NUM_PARTICLES; ++i) {
+    Random::GridDistribution dist{m_nGridCols, m_nGridCols, gridCellWidth, gridCellHeight,
+                                  displacement};
+    for (int i = 0; i < nParticles; ++i) {
       auto particle = registry.create();
       registry.emplace<InstanceTag>(particle, renderable.getInstanceId());
-      registry.emplace<Transform>(particle, dist.getNext(), PARTICLE_ROTATION,
-                                  PARTICLE_SCALE * glm::vec3(1.f));
-      registry.emplace<Color>(particle, gradient.getColor((float)i / NUM_PARTICLES));
+      auto &transform = registry.emplace<Transform>(particle, dist.getNext(), PARTICLE_ROTATION,
+                                                    PARTICLE_SCALE * glm::vec3(1.f));
+      registry.emplace<TransformHistory>(particle, transform);
+      registry.emplace<Color>(particle, gradient.getColor((float)i / nParticles));
       registry.emplace<Rigidbody>(particle, Random::Velocity2D(PARTICLE_VELOCITY));
       registry.emplace<AABB>(particle, PARTICLE_SCALE, PARTICLE_SCALE);
     }
   }
 
   void ParticleCollisionsScene::dispose() {
-    m_app.inputManager.removeCallback(m_fpsDisplayCallback);
+    m_app.inputManager.removeCallbacks(m_callbacks);
     m_cameraController.dispose();
   }
+
+  void ParticleCollisionsScene::setCirclePath(CirclePath circlePath) {
+    m_circlePath = circlePath;
+    m_app.sceneManager.reloadCurrentScene();
+  }
+
+  void ParticleCollisionsScene::setParticleCount(size_t nGridCols) {
+    m_nGridCols = nGridCols;
+    m_app.sceneManager.reloadCurrentScene();
+  }
+
+  void ParticleCollisionsScene::toggleImpostors() {
+    m_useImpostors = !m_useImpostors;
+    m_app.sceneManager.reloadCurrentScene();
+  }
+
+  void ParticleCollisionsScene::onUpdate(float dt) {
+    m_collisionStatsDelay += dt;
+    if (m_collisionStatsDelay < STATS_UPDATE_DELAY)
+      return;
+    m_collisionStatsDelay = 0.f;
+
+    // Show how long each collision phase took in the last frame
+    const auto &stats = getSystem(m_collisionSystem)->getStats();
+    m_app.registry.get<Text>(m_collisionStatsText).text = std::format(
+        "Collisions: {} pairs, integrate {:.2f}ms, broad {:.2f}ms, narrow {:.2f}ms, "
+        "response {:.2f}ms",
+        stats.nPairs, stats.integrateMs, stats.broadphaseMs, stats.narrowphaseMs,
+        stats.responseMs);
+  }
 } // namespace RenderingBenchmark::Scenes
\ No newline at end of file
@@ -1,9 +1,13 @@
 #pragma once
 
+#include "Systems/CirclesRenderSystem.hpp"
+
 #include <TritiumEngine/Core/Scene.hpp>
 #include <TritiumEngine/Input/InputManager.hpp>
 #include <TritiumEngine/Utilities/CameraController.hpp>
 
+#include <entt/entity/entity.hpp>
+
 using namespace TritiumEngine::Core;
 using namespace TritiumEngine::Input;
 
@@ -12,6 +16,11 @@ namespace TritiumEngine::Core
   class Application;
 }
 
+namespace TritiumEngine::Physics
+{
+  class CollisionSystem;
+}
+
 namespace RenderingBenchmark::Scenes
 {
   using Application = TritiumEngine::Core::Application;
@@ -23,8 +32,21 @@ namespace RenderingBenchmark::Scenes
   protected:
     void init() override;
     void dispose() override;
+    void onUpdate(float dt) override;
+
+    void setCirclePath(RenderingBenchmark::Systems::CirclePath circlePath);
+    void setParticleCount(size_t nGridCols);
+    void toggleImpostors();
+
+    RenderingBenchmark::Systems::CirclePath m_circlePath;
+    size_t m_nGridCols;
+    bool m_useImpostors;
 
     CameraController m_cameraController;
-    CallbackId m_fpsDisplayCallback;
+    CallbackId m_callbacks[6];
+    SystemHandle<TritiumEngine::Physics::CollisionSystem> m_collisionSystem;
+    entt::entity m_collisionStatsText = entt::null;
+    entt::entity m_benchmarkText      = entt::null;
+    float m_collisionStatsDelay       = 0.f;
   };
 } // namespace RenderingBenchmark::Scenes
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "Scenes/TextLabelsScene.hpp"
+#include "Components/Tags.hpp"
+#include "Settings.hpp"
+
+#include <TritiumEngine/Core/Components/NativeScript.hpp>
+#include <TritiumEngine/Rendering/TextRendering/Systems/TextRenderSystem.hpp>
+#include <TritiumEngine/Utilities/Random/Position.hpp>
+#include <TritiumEngine/Utilities/Scripts/FpsStatsUI.hpp>
+
+using namespace RenderingBenchmark::Components;
+using namespace RenderingBenchmark::Settings;
+using namespace TritiumEngine::Utilities;
+
+using Projection = Camera::Projection;
+
+namespace
+{
+  constexpr static float LABEL_SCALE = 0.2f;
+  constexpr static float LABEL_AREA  = 1.8f; // Labels are spread over most of the screen
+} // namespace
+
+namespace RenderingBenchmark::Scenes
+{
+  TextLabelsScene::TextLabelsScene(const std::string &name, Application &app)
+      : Scene(name, app), m_nLabels(10000), m_callbacks() {}
+
+  void TextLabelsScene::init() {
+    // Setup render settings
+    RenderSettings textRenderSettings;
+    textRenderSettings.enableBlend  = true;
+    textRenderSettings.blendSFactor = GL_SRC_ALPHA;
+    textRenderSettings.blendDFactor = GL_ONE_MINUS_SRC_ALPHA;
+
+    // Setup systems
+    addSystem<TextRenderSystem<UiCameraTag::value>>(textRenderSettings);
+
+    auto &registry = m_app.registry;
+    auto &input    = m_app.inputManager;
+
+    // Setup camera
+    float aspect      = m_app.window.getFrameAspect();
+    float camWidth    = VERTICAL_SCREEN_UNITS * aspect;
+    float camHeight   = VERTICAL_SCREEN_UNITS;
+    const auto camPos = glm::vec3{0.f, 0.f, 1.f};
+
+    auto uiCamera = registry.create();
+    registry.emplace<Camera>(uiCamera, Projection::ORTHOGRAPHIC, camWidth, camHeight, camPos);
+    registry.emplace<UiCameraTag>(uiCamera);
+
+    // Setup UI
+    m_titleText = addText(std::format("{} text labels", m_nLabels), {0.f, 0.82f}, 0.6f,
+                          Text::Alignment::BOTTOM_CENTER);
+
+    // Help panel
+    addText("Controls:            ", {-0.97f, 0.75f}, 0.6f, Text::Alignment::TOP_LEFT);
+    addText("1: 1000 labels       ", {-0.95f, 0.6f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("2: 10000 labels      ", {-0.95f, 0.5f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("3: 20000 labels      ", {-0.95f, 0.4f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("4: 50000 labels      ", {-0.95f, 0.3f}, 0.5f, Text::Alignment::TOP_LEFT);
+    addText("F: Toggle FPS display", {-0.95f, 0.15f}, 0.5f, Text::Alignment::TOP_LEFT);
+
+    // Fps stats
+    auto fpsStatsUI = registry.create();
+    auto &script = registry.emplace<NativeScript>(fpsStatsUI, std::make_unique<FpsStatsUI>(m_app));
+    script.getInstance().setEnabled(false);
+
+    // Controls - label counts
+    m_callbacks[0] =
+        input.addKeyCallback(Key::NUM_1, KeyState::RELEASED, [this]() { setLabelCount(1000); });
+    m_callbacks[1] =
+        input.addKeyCallback(Key::NUM_2, KeyState::RELEASED, [this]() { setLabelCount(10000); });
+    m_callbacks[2] =
+        input.addKeyCallback(Key::NUM_3, KeyState::RELEASED, [this]() { setLabelCount(20000); });
+    m_callbacks[3] =
+        input.addKeyCallback(Key::NUM_4, KeyState::RELEASED, [this]() { setLabelCount(50000); });
+
+    // FPS display toggle
+    m_callbacks[4] = input.addKeyCallback(Key::F, KeyState::RELEASED, [&registry, fpsStatsUI]() {
+      registry.get<NativeScript>(fpsStatsUI).getInstance().toggleEnabled();
+    });
+
+    generateLabels();
+  }
+
+  void TextLabelsScene::dispose() { m_app.inputManager.removeCallbacks(m_callbacks); }
+
+  void TextLabelsScene::setLabelCount(int nLabels) {
+    m_nLabels = nLabels;
+    m_app.sceneManager.reloadCurrentScene();
+  }
+
+  void TextLabelsScene::generateLabels() {
+    auto &registry      = m_app.registry;
+    auto &shaderManager = m_app.shaderManager;
+    auto shader         = shaderManager.get("text");
+
+    for (int i = 0; i < m_nLabels; ++i) {
+      auto entity   = registry.create();
+      auto position = Random::CubePosition(LABEL_AREA);
+      registry.emplace<Text>(entity, std::format("Label {}", i), "Hack-Regular", LABEL_SCALE,
+                             Text::Alignment::CENTER);
+      registry.emplace<Transform>(entity, glm::vec3{position.x, position.y, 0.f});
+      registry.emplace<Shader>(entity, shader);
+      registry.emplace<Color>(entity, COLOR_WHITE);
+    }
+  }
+
+  entt::entity TextLabelsScene::addText(const std::string &text, const glm::vec2 &position,
+                                        float scaleFactor, Text::Alignment alignment) {
+    auto &registry      = m_app.registry;
+    auto &shaderManager = m_app.shaderManager;
+
+    auto entity = registry.create();
+    registry.emplace<Text>(entity, text, "Hack-Regular", scaleFactor, alignment);
+    registry.emplace<Transform>(entity, glm::vec3{position.x, position.y, 0.1f});
+    registry.emplace<Shader>(entity, shaderManager.get("text"));
+    registry.emplace<Color>(entity, COLOR_GREEN);
+    return entity;
+  }
+} // namespace RenderingBenchmark::Scenes
\ No newline at end of file
@@ -6,65 +6,68 @@
 #include <TritiumEngine/Core/Components/Rigidbody.hpp>
 #include <TritiumEngine/Core/Components/Transform.hpp>
 #include <TritiumEngine/Core/System.hpp>
+#include <TritiumEngine/Physics/ParticleBatch.hpp>
 #include <TritiumEngine/Utilities/ColorUtils.hpp>
 
+#include <algorithm>
+
 using namespace TritiumEngine::Core;
+using namespace TritiumEngine::Physics;
 using namespace TritiumEngine::Utilities;
 
+namespace
+{
+  // Particle colors by velocity direction, indexed by (x > 0) | (y > 0) << 1
+  constexpr uint32_t BOUNCE_COLORS[4] = {COLOR_YELLOW, COLOR_GREEN, COLOR_BLUE, COLOR_RED};
+
+  // Particles are gathered in batches small enough to stay in cache until they are written back
+  constexpr size_t PARTICLE_BATCH_SIZE = 256;
+} // namespace
+
 namespace RenderingBenchmark::Systems
 {
-  BoxContainerSystem::BoxContainerSystem(float boxSize) : System(), m_boxSize(boxSize) {}
+  BoxContainerSystem::BoxContainerSystem(float boxSize) : System(), m_boxSize(boxSize) {
+    writes<Rigidbody, Transform, Color>();
+  }
 
+  /**
+   * @brief Moves all particles and reflects them off the box walls. Particles are split into
+   * chunks across all threads, and each chunk is gathered into ParticleBatches so 4 or 8
+   * particles are integrated per SIMD register. Particles that bounced take the color of the
+   * quadrant their new velocity points to.
+   */
   void BoxContainerSystem::update(float dt) {
-    m_app->registry.view<Rigidbody, Transform, Color>().each(
-        [&](auto entity, Rigidbody &rigidbody, Transform &transform, Color &color) {
-          bool hasCollided  = false;
-          float halfBoxSize = m_boxSize / 2.f;
-          auto nextPos      = transform.position + rigidbody.velocity * dt;
-
-          if (nextPos.x > halfBoxSize) {
-            rigidbody.velocity.x *= -1;
-            float diff = nextPos.x - halfBoxSize;
-            nextPos    = {halfBoxSize - diff, nextPos.y, nextPos.z};
-            updateColor(rigidbody.velocity, color);
-          }
+    float halfBoxSize = m_boxSize / 2.f;
+    auto view         = m_app->registry.view<Rigidbody, Transform, Color>();
+    m_entities.assign(view.begin(), view.end());
 
-          if (nextPos.x < -halfBoxSize) {
-            rigidbody.velocity.x *= -1;
-            float diff = nextPos.x + halfBoxSize;
-            nextPos    = {-halfBoxSize - diff, nextPos.y, nextPos.z};
-            updateColor(rigidbody.velocity, color);
-          }
+    m_app->jobSystem.parallelFor(m_entities.size(), [&](size_t begin, size_t end) {
+      thread_local ParticleBatch batch;
 
-          if (nextPos.y > halfBoxSize) {
-            rigidbody.velocity.y *= -1;
-            float diff = nextPos.y - halfBoxSize;
-            nextPos    = {nextPos.x, halfBoxSize - diff, nextPos.z};
-            updateColor(rigidbody.velocity, color);
-          }
+      for (size_t batchBegin = begin; batchBegin < end; batchBegin += PARTICLE_BATCH_SIZE) {
+        size_t batchEnd = std::min(batchBegin + PARTICLE_BATCH_SIZE, end);
 
-          if (nextPos.y < -halfBoxSize) {
-            rigidbody.velocity.y *= -1;
-            float diff = nextPos.y + halfBoxSize;
-            nextPos    = {nextPos.x, -halfBoxSize - diff, nextPos.z};
-            updateColor(rigidbody.velocity, color);
-          }
+        batch.resize(batchEnd - batchBegin);
+        for (size_t i = batchBegin; i < batchEnd; ++i) {
+          const auto &[rigidbody, transform] = view.get<Rigidbody, Transform>(m_entities[i]);
+          batch.set(i - batchBegin, transform.getPosition(), rigidbody.velocity);
+        }
 
-          transform.position = nextPos;
-        });
-  }
+        batch.reflectInBox(halfBoxSize, dt);
 
-  void BoxContainerSystem::updateColor(glm::vec3 &velocity, Color &color) {
-    bool posVelocityX = velocity.x > 0;
-    bool posVelocityY = velocity.y > 0;
+        for (size_t i = batchBegin; i < batchEnd; ++i) {
+          auto [rigidbody, transform, color] = view.get(m_entities[i]);
+          size_t index                       = i - batchBegin;
+          rigidbody.velocity                 = batch.getVelocity(index);
+          transform.setPosition(batch.getPosition(index));
 
-    if (posVelocityX && posVelocityY)
-      color = COLOR_RED;
-    if (posVelocityX && !posVelocityY)
-      color = COLOR_GREEN;
-    if (!posVelocityX && posVelocityY)
-      color = COLOR_BLUE;
-    if (!posVelocityX && !posVelocityY)
-      color = COLOR_YELLOW;
+          if (batch.hasBounced(index)) {
+            const auto &velocity = rigidbody.velocity;
+            int quadrant         = (velocity.x > 0.f ? 1 : 0) | (velocity.y > 0.f ? 2 : 0);
+            color.value          = BOUNCE_COLORS[quadrant];
+          }
+        }
+      }
+    });
   }
 } // namespace RenderingBenchmark::Systems
\ No newline at end of file
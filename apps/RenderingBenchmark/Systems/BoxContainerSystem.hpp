@@ -3,6 +3,10 @@
 #include <TritiumEngine/Core/System.hpp>
 #include <TritiumEngine/Rendering/Components/Color.hpp>
 
+#include <entt/entity/entity.hpp>
+
+#include <vector>
+
 using namespace TritiumEngine::Core;
 using namespace TritiumEngine::Rendering;
 
@@ -14,8 +18,7 @@ namespace RenderingBenchmark::Systems
     void update(float dt) override;
 
   private:
-    void updateColor(glm::vec3 &velocity, Color &color);
-
     float m_boxSize;
+    std::vector<entt::entity> m_entities;
   };
 } // namespace RenderingBenchmark::Systems
\ No newline at end of file
@@ -3,32 +3,103 @@
 #include <TritiumEngine/Physics/Components/AABB.hpp>
 #include <TritiumEngine/Rendering/Components/Camera.hpp>
 #include <TritiumEngine/Rendering/Components/InstancedRenderable.hpp>
+#include <TritiumEngine/Rendering/Components/LodPolicy.hpp>
 #include <TritiumEngine/Rendering/Components/Shader.hpp>
+#include <TritiumEngine/Rendering/DensityImpostor.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
+#include <TritiumEngine/Rendering/GpuCuller.hpp>
 #include <TritiumEngine/Rendering/Systems/RenderSystem.hpp>
 #include <TritiumEngine/Utilities/ColorUtils.hpp>
 
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 using namespace TritiumEngine::Physics;
 
 namespace RenderingBenchmark::Systems
 {
+  /** @brief Technique used to draw the circles */
+  enum class CirclePath {
+    GEOMETRY,  // Polygons with a LOD dependent number of sides, built by a geometry shader
+    SDF_QUADS, // Quads shaded with the signed distance to the circle, needs a quad mesh
+    POINTS     // Single points, needs a point mesh
+  };
+
+  /**
+   * @brief Draws instanced circles, sorting the instances into square chunks by position. Each
+   * chunk owns a contiguous range of the instance buffer with spare slots, so instances moving to
+   * another chunk are re-binned in place. Chunks are only re-uploaded once their members changed,
+   * and only chunks overlapping the camera are uploaded and drawn. Where supported, the instances
+   * of visible chunks are culled individually on the GPU and drawn indirectly.
+   * Circle detail follows a LodPolicy on the instanced renderable's entity if it has one, halving
+   * the number of sides per level, otherwise it scales with the number of visible instances.
+   * Circles can also be drawn as anti-aliased distance field quads or points, see CirclePath.
+   * Once circles shrink below the impostor size on screen, the visible ones are splatted into a
+   * DensityImpostor instead, so drawing no longer scales with the number of instances.
+   */
   template <uint32_t CameraTag> class CirclesRenderSystem : public RenderSystem<CameraTag> {
   public:
+    constexpr static int NUM_LOD_LEVELS = 6; // 60, 30, 15, 7 and 3 sides, then points
+
     CirclesRenderSystem(RenderSettings renderSettings = {}, int minEntities = 10000,
-                        int maxEntities = 200000)
+                        int maxEntities = 200000, float chunkSize = 500.f)
         : RenderSystem<CameraTag>(renderSettings), m_minEntities(minEntities),
-          m_maxEntities(maxEntities) {
+          m_maxEntities(maxEntities), m_chunkSize(chunkSize),
+          m_useGpuCulling(GpuCuller::isSupported()) {
       // Calculate scale factor
       m_logScaleFactor =
           static_cast<float>(MAX_CIRCLE_SIDES) / logf((float)m_minEntities / m_maxEntities);
       glPointSize(2);
+
+      RenderSystem<CameraTag>::template reads<Transform, AABB, Color, LodPolicy>();
+      RenderSystem<CameraTag>::template writes<InstancedRenderable>();
     }
 
+    void update(float dt) override {
+      auto &registry    = RenderSystem<CameraTag>::m_app->registry;
+      auto instanceView = registry.view<Transform, AABB, Color>();
+
+      // Chunk membership only depends on positions, so it is shared by all cameras. Members
+      // joining or leaving the set shift every slot, so the grid is then rebuilt from scratch
+      registry.view<InstancedRenderable>().each([&](auto entity, InstancedRenderable &renderable) {
+        auto &grid = m_chunkGrids[renderable.getInstanceId()];
+        if (grid.chunks.empty() || grid.membershipVersion != renderable.getMembershipVersion() ||
+            !rebinChunks(grid, instanceView))
+          sortIntoChunks(grid, renderable, instanceView);
+      });
+
+      RenderSystem<CameraTag>::update(dt);
+    }
+
+    /** @brief Enables culling individual instances on the GPU, if supported by the context */
+    void setGpuCulling(bool enable) { m_useGpuCulling = enable && GpuCuller::isSupported(); }
+
+    /**
+     * @brief Selects how circles are drawn. The mesh of the instanced renderables must match the
+     * path, quads spanning -1 to 1 for SDF_QUADS and points otherwise.
+     */
+    void setCirclePath(CirclePath circlePath) { m_circlePath = circlePath; }
+
+    /**
+     * @brief Sets the size in pixels below which the largest instance extent switches drawing to
+     * a density impostor. A size of 0 disables impostors.
+     */
+    void setImpostorSize(float maxPixels) { m_impostorSize = maxPixels; }
+
     void draw(const Camera &camera) const override {
       auto &shaderManager = RenderSystem<CameraTag>::m_app->shaderManager;
       auto &registry      = RenderSystem<CameraTag>::m_app->registry;
+      auto instanceView   = registry.view<Transform, AABB, Color>();
 
       // Calculate projection view matrix and world-space camera bounds
-      const auto &projViewMatrix = camera.calcProjectionViewMatrix();
+      const auto &projViewMatrix = camera.getProjectionViewMatrix();
       const auto &invProjMatrix  = glm::inverse(projViewMatrix);
       const auto &bottomLeft     = invProjMatrix * glm::vec4(-1.f, -1.f, 0.f, 1.f);
       const auto &topRight       = invProjMatrix * glm::vec4(1.f, 1.f, 0.f, 1.f);
@@ -41,51 +112,480 @@ namespace RenderingBenchmark::Systems
         unsigned int vao        = renderable.getVao();
         int vertexStride        = renderable.getVertexStride();
         int nVertices           = renderable.getNumVertices();
+        int nIndices            = renderable.getNumIndices();
         unsigned int renderMode = renderable.getRenderMode();
-        uint32_t instanceId     = renderable.getInstanceId();
 
-        // Update model matrices and color
-        int index = 0;
-        registry.view<Transform, AABB, Color, InstanceTag>().each(
-            [&](auto entity, Transform &transform, AABB &aabb, Color &color, InstanceTag &tag) {
-              if (tag.value != instanceId)
-                return;
+        auto gridIt = m_chunkGrids.find(renderable.getInstanceId());
+        if (gridIt == m_chunkGrids.end())
+          return;
 
-              float x  = transform.position.x;
-              float y  = transform.position.y;
-              float hw = aabb.width;
-              float hh = aabb.height;
+        // Instances too small to make out are only drawn as their density
+        ChunkGrid &grid     = gridIt->second;
+        glm::vec4 bounds    = {left, right, bottom, top};
+        auto &window        = RenderSystem<CameraTag>::m_app->window;
+        float pixelsPerUnit = window.getFrameHeight() / (top - bottom);
+        if (grid.maxExtent * pixelsPerUnit < m_impostorSize) {
+          drawImpostor(grid, instanceView, bounds, window.getFrameWidth(),
+                       window.getFrameHeight());
+          return;
+        }
 
-              if (x + hw >= left && x - hw <= right && y + hh >= bottom && y - hh <= top)
-                renderable.setInstanceData(index++, {transform.getModelMatrix(), color.value});
-            });
-        renderable.updateInstanceDataBuffer();
+        // Update instance data of changed chunks overlapping the camera bounds
+        int nInstances = 0;
+        switch (renderable.getInstanceLayout()) {
+        case InstanceLayout::MAT4:
+          nInstances = writeVisibleChunks<InstanceData>(grid, renderable, instanceView, bounds);
+          break;
+        case InstanceLayout::COMPACT_2D:
+          nInstances = writeVisibleChunks<InstanceData2D>(grid, renderable, instanceView, bounds);
+          break;
+        case InstanceLayout::COMPACT_2D_HALF:
+          nInstances =
+              writeVisibleChunks<InstanceData2DHalf>(grid, renderable, instanceView, bounds);
+          break;
+        }
 
         // Calculate number of sides to use for each particle
-        int nInstances      = index;
-        int nScaleInstances = std::min(std::max(nInstances, m_minEntities), m_maxEntities);
-        int nSides          = static_cast<int>(
-            std::ceil(m_logScaleFactor * logf((float)nScaleInstances / m_maxEntities)));
+        int nSides = 0;
+        if (const auto *lodPolicy = registry.try_get<LodPolicy>(entity)) {
+          nSides = MAX_CIRCLE_SIDES >> lodPolicy->getLevel();
+        } else {
+          int nScaleInstances = std::min(std::max(nInstances, m_minEntities), m_maxEntities);
+          nSides              = static_cast<int>(
+              std::ceil(m_logScaleFactor * logf((float)nScaleInstances / m_maxEntities)));
+        }
+
+        // Geometry circles fall back to points below 3 sides, compact layouts need own shaders
+        bool isCompact         = renderable.getInstanceLayout() != InstanceLayout::MAT4;
+        const char *shaderName = nullptr;
+        switch (m_circlePath) {
+        case CirclePath::GEOMETRY:
+          shaderName = nSides > 2 ? (isCompact ? "circles2d" : "circles")
+                                  : (isCompact ? "instanced2d" : "instanced");
+          break;
+        case CirclePath::SDF_QUADS:
+          shaderName = isCompact ? "circles2d_sdf" : "circles_sdf";
+          break;
+        case CirclePath::POINTS:
+          shaderName = isCompact ? "instanced2d" : "instanced";
+          break;
+        }
+
+        // Cull the instances of each visible row of chunks, which are contiguous in the instance
+        // buffer, before switching to the drawing shader
+        if (m_useGpuCulling) {
+          if (!grid.culler)
+            grid.culler = std::make_unique<GpuCuller>(shaderManager);
 
-        const std::string &shaderName =
-            nSides > 2 ? "circles" : "instanced"; // draw with points if using less than 3 sides
+          grid.culler->begin(renderable, projViewMatrix);
+          for (const auto &[start, count] : grid.drawRanges)
+            grid.culler->cull(start, count);
+        }
 
         shaderManager.use(shaderName);
-        shaderManager.setMatrix4("projectionView", projViewMatrix);
         shaderManager.setInt("nSides", nSides);
 
-        // Draw the renderable
-        glBindVertexArray(vao);
-        glDrawArraysInstanced(renderMode, 0, nVertices / vertexStride, nInstances);
+        // Draw culled instances indirectly, or each visible row of chunks as a whole
+        if (m_useGpuCulling) {
+          grid.culler->draw(renderable);
+        } else {
+          GLState::bindVertexArray(vao);
+          for (const auto &[start, count] : grid.drawRanges) {
+            if (nIndices > 0)
+              glDrawElementsInstancedBaseInstance(renderMode, nIndices, GL_UNSIGNED_INT, 0,
+                                                  static_cast<int>(count), start);
+            else
+              glDrawArraysInstancedBaseInstance(renderMode, 0, nVertices / vertexStride,
+                                                static_cast<int>(count), start);
+          }
+        }
       });
       shaderManager.use(0);
     }
 
   private:
-    const static int MAX_CIRCLE_SIDES = 60;
+    /** @brief Instances of an instanced renderable sorted into a uniform grid of chunks */
+    struct ChunkGrid {
+      struct Chunk {
+        uint32_t start      = 0;     // Index of the first slot of the chunk in the instance buffer
+        uint32_t count      = 0;     // Number of members, held by the first slots
+        uint32_t capacity   = 0;     // Number of slots, spare ones take members moving in
+        bool isDirty        = true;  // Members changed since the last upload
+        bool isInterpolated = false; // Last upload was in between two simulation states
+      };
+
+      /** @brief Bounds and largest instance extent found by a single job */
+      struct JobBounds {
+        glm::vec2 min;
+        glm::vec2 max;
+        float maxExtent;
+      };
+
+      /** @brief Instance that moved to another chunk, found by a re-binning job */
+      struct Move {
+        uint32_t slot;
+        uint32_t from;
+        uint32_t to;
+      };
+
+      /** @brief Moves and largest changed instance extent found by a single re-binning job */
+      struct JobRebin {
+        std::vector<Move> moves;
+        float maxExtent;
+        bool hasLeftGrid;
+      };
+
+      glm::vec2 origin           = glm::vec2(0.f);
+      glm::ivec2 size            = glm::ivec2(0);
+      float maxExtent            = 0.f;
+      bool isClamped             = false; // The grid could not grow to cover all instances
+      uint32_t membershipVersion = 0;
+      std::vector<Chunk> chunks;
+      std::vector<entt::entity> instances;  // Member of each slot, sorted by chunk
+      std::vector<uint32_t> versions;       // Transform version of each slot's member
+      std::vector<uint32_t> colors;         // Color of each slot's member
+      std::vector<uint32_t> instanceChunks; // Chunk of each instance of the renderable
+      std::vector<uint32_t> cursors;        // Next free slot of each chunk while sorting
+      std::vector<JobBounds> jobBounds;
+      std::vector<JobRebin> jobRebins;
+      std::vector<std::pair<uint32_t, uint32_t>> drawRanges; // Start and count of visible runs
+      std::unique_ptr<GpuCuller> culler;
+      std::unique_ptr<DensityImpostor> impostor;
+    };
+
+    /**
+     * @brief Sorts the instances of a renderable into chunks from scratch. The grid origin is
+     * snapped to the chunk size and every chunk gets spare slots, growing the instance buffer to
+     * fit them. All chunks are uploaded again afterwards.
+     */
+    template <typename View>
+    void sortIntoChunks(ChunkGrid &grid, InstancedRenderable &renderable,
+                        const View &instanceView) {
+      auto &jobSystem        = RenderSystem<CameraTag>::m_app->jobSystem;
+      const auto &instances  = renderable.getInstances();
+      size_t nInstances      = instances.size();
+      constexpr float maxVal = std::numeric_limits<float>::max();
+
+      // Find the area covered by all instances, each job reduces its own range first
+      size_t jobSize = jobSystem.getChunkSize(nInstances);
+      size_t nJobs   = (nInstances + jobSize - 1) / jobSize;
+      grid.jobBounds.assign(nJobs, {glm::vec2(maxVal), glm::vec2(-maxVal), 0.f});
+
+      jobSystem.parallelFor(
+          nInstances,
+          [&](size_t begin, size_t end) {
+            auto &bounds = grid.jobBounds[begin / jobSize];
+            for (size_t i = begin; i < end; ++i) {
+              const auto &[transform, aabb] =
+                  instanceView.template get<Transform, AABB>(instances[i]);
+              glm::vec2 position = glm::vec2(transform.getPosition());
+              bounds.min         = glm::min(bounds.min, position);
+              bounds.max         = glm::max(bounds.max, position);
+              bounds.maxExtent   = std::max(bounds.maxExtent, std::max(aabb.width, aabb.height));
+            }
+          },
+          jobSize);
+
+      glm::vec2 min  = glm::vec2(maxVal);
+      glm::vec2 max  = glm::vec2(-maxVal);
+      grid.maxExtent = 0.f;
+      for (const auto &bounds : grid.jobBounds) {
+        min            = glm::min(min, bounds.min);
+        max            = glm::max(max, bounds.max);
+        grid.maxExtent = std::max(grid.maxExtent, bounds.maxExtent);
+      }
+
+      grid.origin    = glm::vec2(0.f);
+      grid.size      = glm::ivec2(1);
+      grid.isClamped = false;
+      if (nInstances > 0) {
+        grid.origin    = glm::floor(min / m_chunkSize) * m_chunkSize;
+        grid.size      = glm::ivec2(glm::floor((max - grid.origin) / m_chunkSize)) + 1;
+        grid.isClamped = glm::any(glm::greaterThan(grid.size, glm::ivec2(MAX_CHUNKS_PER_AXIS)));
+        grid.size      = glm::min(grid.size, MAX_CHUNKS_PER_AXIS);
+      }
+      grid.chunks.assign(static_cast<size_t>(grid.size.x) * grid.size.y, {});
+      grid.membershipVersion = renderable.getMembershipVersion();
+
+      grid.instanceChunks.resize(nInstances);
+      jobSystem.parallelFor(
+          nInstances,
+          [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+              const auto &transform  = instanceView.template get<Transform>(instances[i]);
+              glm::ivec2 cell        = getChunkCell(grid, glm::vec2(transform.getPosition()));
+              grid.instanceChunks[i] = static_cast<uint32_t>(cell.y * grid.size.x + cell.x);
+            }
+          },
+          jobSize);
+
+      // Counting sort of instances by chunk, keeping their order within each chunk
+      for (uint32_t chunk : grid.instanceChunks)
+        ++grid.chunks[chunk].count;
+
+      uint32_t start = 0;
+      for (auto &chunk : grid.chunks) {
+        chunk.start    = start;
+        chunk.capacity = chunk.count + chunk.count / CHUNK_SLACK_DIVISOR + MIN_CHUNK_SLACK;
+        start += chunk.capacity;
+      }
+
+      grid.instances.assign(start, entt::null);
+      grid.versions.resize(start);
+      grid.colors.resize(start);
+      grid.cursors.assign(grid.chunks.size(), 0);
+      for (size_t i = 0; i < nInstances; ++i) {
+        uint32_t chunk                 = grid.instanceChunks[i];
+        uint32_t slot                  = grid.chunks[chunk].start + grid.cursors[chunk]++;
+        const auto &[transform, color] = instanceView.template get<Transform, Color>(instances[i]);
+        grid.instances[slot]           = instances[i];
+        grid.versions[slot]            = transform.getVersion();
+        grid.colors[slot]              = color.value;
+      }
+
+      if (start > static_cast<size_t>(renderable.getNumInstances()))
+        renderable.resizeInstanceDataBuffer(start);
+    }
+
+    /**
+     * @brief Moves the instances whose transform changed since the last frame into the chunk they
+     * now fall into, and marks chunks with changed members dirty. Jobs scan separate ranges of
+     * chunks and collect their moves, which are then applied by swapping the moved instance with
+     * the last member of its chunk and appending it to a spare slot of its new chunk.
+     * @return False if the grid must be sorted from scratch, as an instance left the grid or a
+     * chunk ran out of spare slots
+     */
+    template <typename View> bool rebinChunks(ChunkGrid &grid, const View &instanceView) {
+      auto &jobSystem = RenderSystem<CameraTag>::m_app->jobSystem;
+      size_t nChunks  = grid.chunks.size();
+
+      // There are far fewer chunks than the job system's minimum chunk size, so jobs are sized by
+      // the number of threads instead
+      size_t nThreads = jobSystem.getNumWorkers() + 1;
+      size_t jobSize  = std::max(nChunks / (nThreads * REBIN_JOBS_PER_THREAD), size_t(1));
+      grid.jobRebins.resize((nChunks + jobSize - 1) / jobSize);
+
+      jobSystem.parallelFor(
+          nChunks,
+          [&](size_t begin, size_t end) {
+            auto &job = grid.jobRebins[begin / jobSize];
+            job.moves.clear();
+            job.maxExtent   = 0.f;
+            job.hasLeftGrid = false;
+
+            for (size_t c = begin; c < end; ++c) {
+              auto &chunk = grid.chunks[c];
+              for (uint32_t slot = chunk.start; slot < chunk.start + chunk.count; ++slot) {
+                const auto &[transform, aabb, color] =
+                    instanceView.template get<Transform, AABB, Color>(grid.instances[slot]);
+                if (color.value != grid.colors[slot]) {
+                  grid.colors[slot] = color.value;
+                  chunk.isDirty     = true;
+                }
+                if (transform.getVersion() == grid.versions[slot])
+                  continue;
+
+                grid.versions[slot] = transform.getVersion();
+                chunk.isDirty       = true;
+                job.maxExtent       = std::max(job.maxExtent, std::max(aabb.width, aabb.height));
+
+                glm::vec2 position = glm::vec2(transform.getPosition());
+                glm::ivec2 cell    = getChunkCell(grid, position);
+                job.hasLeftGrid |=
+                    !grid.isClamped &&
+                    cell != glm::ivec2(glm::floor((position - grid.origin) / m_chunkSize));
+
+                uint32_t to = static_cast<uint32_t>(cell.y * grid.size.x + cell.x);
+                if (to != c)
+                  job.moves.push_back({slot, static_cast<uint32_t>(c), to});
+              }
+            }
+          },
+          jobSize);
+
+      for (const auto &job : grid.jobRebins) {
+        if (job.hasLeftGrid)
+          return false;
+        grid.maxExtent = std::max(grid.maxExtent, job.maxExtent);
+      }
+
+      // Moves out of each chunk are applied from its last slot down, so the member swapped into a
+      // vacated slot has either already moved or stays in the chunk
+      for (const auto &job : grid.jobRebins) {
+        for (auto it = job.moves.rbegin(); it != job.moves.rend(); ++it) {
+          auto &from = grid.chunks[it->from];
+          auto &to   = grid.chunks[it->to];
+          if (to.count == to.capacity)
+            return false;
+
+          uint32_t last = from.start + --from.count;
+          moveSlot(grid, it->slot, to.start + to.count++);
+          moveSlot(grid, last, it->slot);
+          grid.instances[last] = entt::null;
+          to.isDirty           = true;
+        }
+      }
+      return true;
+    }
+
+    static void moveSlot(ChunkGrid &grid, uint32_t from, uint32_t to) {
+      grid.instances[to] = grid.instances[from];
+      grid.versions[to]  = grid.versions[from];
+      grid.colors[to]    = grid.colors[from];
+    }
+
+    /**
+     * @brief Writes the instance data of chunks overlapping the camera bounds whose members
+     * changed since their last upload, and collects the instance ranges to draw. Chunks holding
+     * interpolated members change with every frame, so they are always written. Runs of adjacent
+     * chunks within a row are contiguous in the buffer and uploaded at once.
+     * @param bounds Camera bounds as left, right, bottom and top
+     * @return Number of instances in visible chunks
+     */
+    template <typename T, typename View>
+    int writeVisibleChunks(ChunkGrid &grid, InstancedRenderable &renderable,
+                           const View &instanceView, const glm::vec4 &bounds) const {
+      // Persistent buffers move on to a new region every frame, which holds no previous uploads
+      bool keepsUploads = renderable.getUploadMode() == InstancedRenderable::UploadMode::STAGED;
+      T *instanceData   = renderable.beginInstanceDataUpdate<T>();
+      grid.drawRanges.clear();
+
+      // Instances may overlap neighbouring chunks by up to their extent
+      float margin     = grid.maxExtent;
+      glm::ivec2 first = getChunkCell(grid, {bounds[0] - margin, bounds[2] - margin});
+      glm::ivec2 last  = getChunkCell(grid, {bounds[1] + margin, bounds[3] + margin});
+
+      int nInstances = 0;
+      for (int y = first.y; y <= last.y; ++y) {
+        auto *rowBegin       = &grid.chunks[static_cast<size_t>(y) * grid.size.x];
+        uint32_t uploadStart = 0;
+        uint32_t uploadEnd   = 0; // End of the members of the last chunk to upload
+        uint32_t runEnd      = 0; // End of the slots of the last chunk to upload
+
+        for (int x = first.x; x <= last.x; ++x) {
+          auto &chunk = rowBegin[x];
+          nInstances += static_cast<int>(chunk.count);
+
+          // Spare slots are never drawn, so members of chunks that are full continue the range
+          // of the next chunk
+          if (chunk.count > 0) {
+            if (x > first.x && rowBegin[x - 1].count == rowBegin[x - 1].capacity)
+              grid.drawRanges.back().second += chunk.count;
+            else
+              grid.drawRanges.emplace_back(chunk.start, chunk.count);
+          }
+
+          if (keepsUploads && !chunk.isDirty && !chunk.isInterpolated)
+            continue;
+
+          chunk.isInterpolated = RenderSystem<CameraTag>::writeInstanceData(
+              &grid.instances[chunk.start], chunk.count, instanceView, &instanceData[chunk.start]);
+          chunk.isDirty = false;
+
+          if (runEnd != chunk.start || uploadEnd == uploadStart) {
+            if (uploadEnd > uploadStart)
+              renderable.updateInstanceDataBuffer(uploadStart, uploadEnd - uploadStart);
+            uploadStart = chunk.start;
+          }
+          uploadEnd = chunk.start + chunk.count;
+          runEnd    = chunk.start + chunk.capacity;
+        }
+
+        if (uploadEnd > uploadStart)
+          renderable.updateInstanceDataBuffer(uploadStart, uploadEnd - uploadStart);
+      }
+      return nInstances;
+    }
+
+    /**
+     * @brief Splats the instances of chunks overlapping the camera bounds into the density
+     * impostor of the grid and draws it. Jobs fill separate bands of texel rows, visiting only the
+     * rows of chunks overlapping their band.
+     * @param bounds Camera bounds as left, right, bottom and top
+     * @param frameWidth Width of the frame in pixels
+     * @param frameHeight Height of the frame in pixels
+     */
+    template <typename View>
+    void drawImpostor(ChunkGrid &grid, const View &instanceView, const glm::vec4 &bounds,
+                      int frameWidth, int frameHeight) const {
+      auto &app = *RenderSystem<CameraTag>::m_app;
+      if (!grid.impostor)
+        grid.impostor = std::make_unique<DensityImpostor>(app.shaderManager);
+
+      auto &impostor = *grid.impostor;
+      impostor.resize(frameWidth / IMPOSTOR_TEXEL_PIXELS, frameHeight / IMPOSTOR_TEXEL_PIXELS);
+      impostor.clear();
+
+      glm::ivec2 size         = impostor.getSize();
+      glm::vec2 origin        = {bounds[0], bounds[2]};
+      glm::vec2 extent        = {bounds[1] - bounds[0], bounds[3] - bounds[2]};
+      glm::vec2 texelsPerUnit = glm::vec2(size) / extent;
+      float texelArea         = (extent.x / size.x) * (extent.y / size.y);
+
+      // The texture has far fewer rows than the job system's minimum chunk size, so bands are
+      // sized by the number of threads instead
+      size_t nThreads = app.jobSystem.getNumWorkers() + 1;
+      size_t nBands   = nThreads * IMPOSTOR_BANDS_PER_THREAD;
+      size_t bandSize = std::max(static_cast<size_t>(size.y) / nBands, size_t(1));
+
+      app.jobSystem.parallelFor(
+          static_cast<size_t>(size.y),
+          [&](size_t begin, size_t end) {
+            // Widened by a texel, so instances on the band edges are never missed to rounding
+            float bandBottom = origin.y + (begin - 1.f) / texelsPerUnit.y;
+            float bandTop    = origin.y + (end + 1.f) / texelsPerUnit.y;
+            glm::ivec2 first = getChunkCell(grid, {bounds[0], bandBottom});
+            glm::ivec2 last  = getChunkCell(grid, {bounds[1], bandTop});
+
+            for (int y = first.y; y <= last.y; ++y) {
+              for (int x = first.x; x <= last.x; ++x) {
+                const auto &chunk = grid.chunks[static_cast<size_t>(y) * grid.size.x + x];
+                for (uint32_t i = chunk.start; i < chunk.start + chunk.count; ++i) {
+                  const auto &[transform, color] =
+                      instanceView.template get<Transform, Color>(grid.instances[i]);
+                  glm::vec2 position = glm::vec2(transform.getPosition());
+                  glm::ivec2 texel   = glm::ivec2(glm::floor((position - origin) * texelsPerUnit));
+                  if (texel.y < static_cast<int>(begin) || texel.y >= static_cast<int>(end) ||
+                      texel.x < 0 || texel.x >= size.x)
+                    continue;
+
+                  float radius = transform.getScale().x;
+                  impostor.splat(texel.x, texel.y, color.value,
+                                 glm::pi<float>() * radius * radius);
+                }
+              }
+            }
+          },
+          bandSize);
+
+      impostor.upload(texelArea);
+      impostor.draw();
+    }
+
+    // Obtains the chunk a position falls into, positions outside the grid use the nearest chunk
+    glm::ivec2 getChunkCell(const ChunkGrid &grid, const glm::vec2 &position) const {
+      glm::vec2 cell = glm::floor((position - grid.origin) / m_chunkSize);
+      cell           = glm::clamp(cell, glm::vec2(0.f), glm::vec2(grid.size - 1));
+      return glm::ivec2(cell);
+    }
+
+    const static int MAX_CIRCLE_SIDES                 = 60;
+    constexpr static int MAX_CHUNKS_PER_AXIS          = 256;
+    constexpr static uint32_t CHUNK_SLACK_DIVISOR     = 4; // Members per spare slot of a chunk
+    constexpr static uint32_t MIN_CHUNK_SLACK         = 8; // Spare slots of even empty chunks
+    constexpr static size_t REBIN_JOBS_PER_THREAD     = 4;
+    constexpr static int IMPOSTOR_TEXEL_PIXELS        = 2; // Width and height of impostor texels
+    constexpr static size_t IMPOSTOR_BANDS_PER_THREAD = 4; // Spare bands for idle threads to steal
 
     float m_logScaleFactor;
     int m_minEntities;
     int m_maxEntities;
+    float m_chunkSize;
+    bool m_useGpuCulling;
+    CirclePath m_circlePath = CirclePath::GEOMETRY;
+    float m_impostorSize    = 0.f;
+
+    // Chunk uploads are tracked while drawing, which happens from the const draw()
+    mutable std::unordered_map<uint32_t, ChunkGrid> m_chunkGrids;
   };
 } // namespace RenderingBenchmark::Systems
\ No newline at end of file
@@ -3,13 +3,16 @@
 #include <TritiumEngine/Rendering/Components/Camera.hpp>
 #include <TritiumEngine/Rendering/Components/InstancedRenderable.hpp>
 #include <TritiumEngine/Rendering/Components/Shader.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
 #include <TritiumEngine/Rendering/Systems/RenderSystem.hpp>
 
 namespace RenderingBenchmark::Systems
 {
   template <uint32_t CameraTag> class CubeRenderSystem : public RenderSystem<CameraTag> {
   public:
-    CubeRenderSystem(RenderSettings renderSettings) : RenderSystem<CameraTag>(renderSettings) {}
+    CubeRenderSystem(RenderSettings renderSettings) : RenderSystem<CameraTag>(renderSettings) {
+      RenderSystem<CameraTag>::template reads<InstancedRenderable, Shader>();
+    }
 
     void draw(const Camera &camera) const override {
       auto &registry      = RenderSystem<CameraTag>::m_app->registry;
@@ -23,13 +26,11 @@ namespace RenderingBenchmark::Systems
             int nInstances          = renderable.getNumInstances();
             unsigned int renderMode = renderable.getRenderMode();
 
-            if (shader.id != shaderManager.getCurrentShader()) {
+            if (shader.id != shaderManager.getCurrentShader())
               shaderManager.use(shader.id);
-              shaderManager.setMatrix4("projectionView", camera.calcProjectionViewMatrix());
-            }
 
             // Draw the renderable
-            glBindVertexArray(vao);
+            GLState::bindVertexArray(vao);
             glDrawArraysInstanced(renderMode, 0, nVertices / vertexStride, nInstances);
           });
       shaderManager.use(0);
@@ -0,0 +1,111 @@
+#include "Systems/GpuParticleSimulationSystem.hpp"
+#include "Components/Tags.hpp"
+
+#include <TritiumEngine/Core/Application.hpp>
+#include <TritiumEngine/Core/Components/Rigidbody.hpp>
+#include <TritiumEngine/Core/Components/Transform.hpp>
+#include <TritiumEngine/Rendering/Components/Color.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
+#include <TritiumEngine/Utilities/Logger.hpp>
+
+#include <GL/glew.h>
+
+using namespace RenderingBenchmark::Components;
+using namespace TritiumEngine::Rendering;
+using namespace TritiumEngine::Utilities;
+
+namespace RenderingBenchmark::Systems
+{
+  GpuParticleSimulationSystem::GpuParticleSimulationSystem(float boxSize)
+      : System(), m_boxSize(boxSize) {
+    // Dispatches compute work, so it must stay on the thread owning the context
+    setMainThreadOnly();
+
+    reads<GpuParticleTag>();
+    writes<Transform, Rigidbody, Color>();
+  }
+
+  GpuParticleSimulationSystem::~GpuParticleSimulationSystem() {
+    GLState::deleteBuffer(m_particleBuffer);
+  }
+
+  /**
+   * @brief Integrates all particles by one fixed simulation step and makes the results visible to
+   * later shader reads
+   * @param dt Fixed simulation time step
+   */
+  void GpuParticleSimulationSystem::update(float dt) {
+    if (!m_isUploaded)
+      upload();
+    if (m_nParticles == 0)
+      return;
+
+    auto &shaderManager = m_app->shaderManager;
+    shaderManager.use("gpu_particles_sim");
+    shaderManager.setFloat("dt", dt);
+    shaderManager.setFloat("halfBoxSize", m_boxSize / 2.f);
+    shaderManager.setUint("nParticles", m_nParticles);
+
+    GLState::bindBufferBase(GL_SHADER_STORAGE_BUFFER, BUFFER_BINDING, m_particleBuffer);
+    glDispatchCompute((m_nParticles + WORK_GROUP_SIZE - 1) / WORK_GROUP_SIZE, 1, 1);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+    shaderManager.use(0);
+  }
+
+  /**
+   * @brief Copies the current GPU state of all particles back into their entities. Stalls until
+   * the GPU finished all pending simulation steps, so this should only be used on demand.
+   */
+  void GpuParticleSimulationSystem::readback() {
+    if (m_nParticles == 0)
+      return;
+
+    std::vector<Particle> particles(m_nParticles);
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    glGetNamedBufferSubData(m_particleBuffer, 0, particles.size() * sizeof(Particle),
+                            particles.data());
+
+    auto &registry = m_app->registry;
+    for (size_t i = 0; i < m_entities.size(); ++i) {
+      auto entity = m_entities[i];
+      if (!registry.valid(entity))
+        continue;
+
+      const auto &particle = particles[i];
+      auto &transform      = registry.get<Transform>(entity);
+      auto &rigidbody      = registry.get<Rigidbody>(entity);
+      transform.setPosition({particle.position, transform.getPosition().z});
+      rigidbody.velocity = {particle.velocity, rigidbody.velocity.z};
+      registry.get<Color>(entity).value = particle.color;
+    }
+  }
+
+  // Gathers the initial state of all tagged particles into the storage buffer
+  void GpuParticleSimulationSystem::upload() {
+    m_isUploaded = true;
+    if (!GLEW_VERSION_4_3) {
+      Logger::warn("[GpuParticleSimulationSystem] Compute shaders require OpenGL 4.3, particles "
+                   "will not be simulated.");
+      return;
+    }
+
+    auto &registry = m_app->registry;
+    auto view      = registry.view<GpuParticleTag, Transform, Rigidbody, Color>();
+
+    std::vector<Particle> particles;
+    for (auto [entity, transform, rigidbody, color] : view.each()) {
+      particles.push_back({glm::vec2(transform.getPosition()), glm::vec2(rigidbody.velocity),
+                           glm::vec2(transform.getScale()), color.value, 0});
+      m_entities.push_back(entity);
+    }
+
+    m_nParticles = static_cast<unsigned int>(particles.size());
+    if (m_nParticles == 0)
+      return;
+
+    // Only ever written by shaders, no client access flags needed
+    glCreateBuffers(1, &m_particleBuffer);
+    glNamedBufferStorage(m_particleBuffer, particles.size() * sizeof(Particle), particles.data(),
+                         0);
+  }
+} // namespace RenderingBenchmark::Systems
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <TritiumEngine/Core/System.hpp>
+
+#include <entt/entity/entity.hpp>
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace TritiumEngine::Core;
+
+namespace RenderingBenchmark::Systems
+{
+  /**
+   * @brief Simulates particles bouncing inside a box entirely on the GPU. The state of all
+   * particles tagged with GpuParticleTag is uploaded once to a shader storage buffer, which a
+   * compute shader integrates once per fixed simulation step. The entities are only brought up to
+   * date on demand with readback(), drawing is left to GpuParticleSystem.
+   */
+  class GpuParticleSimulationSystem : public System {
+  public:
+    /** @brief Particle state as laid out in the std430 storage buffer */
+    struct Particle {
+      glm::vec2 position;
+      glm::vec2 velocity;
+      glm::vec2 scale;
+      uint32_t color;
+      uint32_t padding;
+    };
+
+    constexpr static unsigned int WORK_GROUP_SIZE = 256; // local_size_x of the compute shader
+    constexpr static unsigned int BUFFER_BINDING  = 0;
+
+    GpuParticleSimulationSystem(float boxSize = 100.f);
+    ~GpuParticleSimulationSystem();
+
+    void update(float dt) override;
+    void readback();
+
+    unsigned int getParticleBuffer() const { return m_particleBuffer; }
+    unsigned int getNumParticles() const { return m_nParticles; }
+
+  private:
+    void upload();
+
+    std::vector<entt::entity> m_entities;
+    unsigned int m_particleBuffer = 0;
+    unsigned int m_nParticles     = 0;
+    float m_boxSize;
+    bool m_isUploaded = false;
+  };
+} // namespace RenderingBenchmark::Systems
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Components/Tags.hpp"
+#include "Systems/GpuParticleSimulationSystem.hpp"
+
+#include <TritiumEngine/Core/Scene.hpp>
+#include <TritiumEngine/Rendering/Components/Camera.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
+#include <TritiumEngine/Rendering/Mesh.hpp>
+#include <TritiumEngine/Rendering/Systems/RenderSystem.hpp>
+
+#include <GL/glew.h>
+
+#include <memory>
+
+using namespace RenderingBenchmark::Components;
+
+namespace RenderingBenchmark::Systems
+{
+  /**
+   * @brief Draws the particles simulated by a GpuParticleSimulationSystem. Instances index the
+   * simulation's storage buffer directly, so nothing is uploaded per frame. The simulation is
+   * resolved through its handle on every draw, so nothing is drawn once it is removed.
+   */
+  template <uint32_t CameraTag> class GpuParticleSystem : public RenderSystem<CameraTag> {
+  public:
+    GpuParticleSystem(RenderSettings renderSettings, std::shared_ptr<Mesh> mesh,
+                      SystemHandle<GpuParticleSimulationSystem> simulation)
+        : RenderSystem<CameraTag>(renderSettings), m_mesh(std::move(mesh)),
+          m_simulation(simulation) {
+      RenderSystem<CameraTag>::template reads<GpuParticleTag>();
+    }
+
+    void draw(const Camera &camera) const override {
+      Application *app = RenderSystem<CameraTag>::m_app;
+      Scene *scene     = app->sceneManager.getCurrentScene();
+      const GpuParticleSimulationSystem *simulation =
+          scene ? scene->getSystem(m_simulation) : nullptr;
+      unsigned int nParticles = simulation ? simulation->getNumParticles() : 0;
+      if (nParticles == 0)
+        return;
+
+      auto &shaderManager = app->shaderManager;
+      shaderManager.use("gpu_particles");
+
+      // Vertices only come from the mesh, instances index the storage buffer by gl_InstanceID
+      GLState::bindVertexArray(m_mesh->getVao());
+      GLState::bindBufferBase(GL_SHADER_STORAGE_BUFFER,
+                              GpuParticleSimulationSystem::BUFFER_BINDING,
+                              simulation->getParticleBuffer());
+      if (m_mesh->getNumIndices() > 0) {
+        glDrawElementsInstanced(GL_TRIANGLES, m_mesh->getNumIndices(), GL_UNSIGNED_INT, 0,
+                                nParticles);
+      } else {
+        int nVertices = m_mesh->getNumVertices() / m_mesh->getVertexStride();
+        glDrawArraysInstanced(GL_TRIANGLES, 0, nVertices, nParticles);
+      }
+      shaderManager.use(0);
+    }
+
+  private:
+    std::shared_ptr<Mesh> m_mesh;
+    SystemHandle<GpuParticleSimulationSystem> m_simulation;
+  };
+} // namespace RenderingBenchmark::Systems
\ No newline at end of file
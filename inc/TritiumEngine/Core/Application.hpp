@@ -1,5 +1,6 @@
 #pragma once
 
+#include <TritiumEngine/Core/JobSystem.hpp>
 #include <TritiumEngine/Core/SceneManager.hpp>
 #include <TritiumEngine/Input/InputManager.hpp>
 #include <TritiumEngine/Rendering/Window.hpp>
@@ -30,20 +31,36 @@ namespace TritiumEngine::Core
     void stop();
     bool isRunning() const;
 
+    void setSimulationRate(float stepsPerSecond);
+    void setMaxSimulationSteps(int maxSteps);
+    float getSimulationTimeStep() const { return m_simulationTimeStep; }
+    float getInterpolationAlpha() const { return m_interpolationAlpha; }
+
     Window window;
     InputManager inputManager;
     ShaderManager shaderManager;
     SceneManager sceneManager;
     entt::registry registry;
     entt::dispatcher dispatcher;
+    JobSystem jobSystem;
 
     const std::string name;
 
   private:
     void initGLEW() const;
 
+    constexpr static float DEFAULT_SIMULATION_RATE    = 60.f;
+    constexpr static int DEFAULT_MAX_SIMULATION_STEPS = 5;
+
+    void simulate(float deltaTime);
+
     bool m_isRunning = false;
     TimePoint m_currentTime;
     TimePoint m_prevFrameTime;
+
+    float m_simulationTimeStep = 1.f / DEFAULT_SIMULATION_RATE;
+    int m_maxSimulationSteps   = DEFAULT_MAX_SIMULATION_STEPS;
+    float m_simulationTime     = 0.f; // Time not yet simulated
+    float m_interpolationAlpha = 1.f;
   };
 } // namespace TritiumEngine::Core
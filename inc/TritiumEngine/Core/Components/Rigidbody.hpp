@@ -6,5 +6,6 @@ namespace TritiumEngine::Core
 {
   struct Rigidbody {
     glm::vec3 velocity = glm::vec3();
+    float mass         = 1.f;
   };
 } // namespace TritiumEngine::Core
\ No newline at end of file
@@ -3,8 +3,12 @@
 #include <glm/glm.hpp>
 #include <glm/gtx/quaternion.hpp>
 
+#include <cstdint>
+
 namespace TritiumEngine::Core
 {
+  class TransformBatch;
+
   struct Transform {
   public:
     constexpr static glm::vec3 RIGHT = {1.f, 0.f, 0.f};
@@ -17,46 +21,102 @@ namespace TritiumEngine::Core
     Transform(const glm::vec3 &position = glm::vec3(0.f),
               const glm::quat &rotation = glm::quat(1.f, 0.f, 0.f, 0.f),
               const glm::vec3 &scale    = glm::vec3(1.f))
-        : position(position), rotation(rotation), scale(scale) {}
+        : m_position(position), m_rotation(rotation), m_scale(scale) {}
 
     Transform(const glm::vec3 &position, const glm::vec3 &rotationEuler,
               const glm::vec3 &scale = glm::vec3(1.f))
-        : position(position), rotation(rotationEuler), scale(scale) {
+        : m_position(position), m_rotation(rotationEuler), m_scale(scale) {}
+
+    const glm::vec3 &getPosition() const { return m_position; }
+    const glm::quat &getRotation() const { return m_rotation; }
+    const glm::vec3 &getScale() const { return m_scale; }
+
+    glm::vec3 getRight() const { return glm::rotate(glm::conjugate(m_rotation), RIGHT); }
+
+    glm::vec3 getUp() const { return glm::rotate(glm::conjugate(m_rotation), UP); }
+
+    glm::vec3 getFront() const { return glm::rotate(glm::conjugate(m_rotation), FRONT); }
+
+    glm::mat4 getViewMatrix() const {
+      return glm::lookAt(m_position, m_position + getFront(), UP);
     }
 
-    glm::vec3 getRight() const { return glm::rotate(glm::conjugate(rotation), RIGHT); }
+    /**
+     * @brief Obtains the model matrix, recalculating it only if the transform changed since it was
+     * last calculated. Dirty transforms are recalculated in bulk once per frame by the scene, so
+     * that reads from render systems only return the cached matrix.
+     */
+    const glm::mat4 &getModelMatrix() const {
+      if (m_isDirty)
+        updateModelMatrix();
+      return m_model;
+    }
+
+    /** @brief Recalculates the cached model matrix from position, rotation and scale */
+    void updateModelMatrix() const {
+      m_model   = glm::translate(glm::mat4(1.0f), m_position);
+      m_model   = m_model * glm::mat4_cast(m_rotation);
+      m_model   = glm::scale(m_model, m_scale);
+      m_isDirty = false;
+    }
 
-    glm::vec3 getUp() const { return glm::rotate(glm::conjugate(rotation), UP); }
+    /** @brief Determines if the cached model matrix is out of date */
+    bool isDirty() const { return m_isDirty; }
 
-    glm::vec3 getFront() const { return glm::rotate(glm::conjugate(rotation), FRONT); }
+    /** @brief Obtains a counter incremented every time the transform changes */
+    uint32_t getVersion() const { return m_version; }
 
-    glm::mat4 getViewMatrix() const { return glm::lookAt(position, position + getFront(), UP); }
+    void setPosition(const glm::vec3 &position) {
+      m_position = position;
+      markDirty();
+    }
 
-    glm::mat4 getModelMatrix() const {
-      // Calculate model from position, rotation and scale
-      auto model = glm::mat4(1.0f);
-      model      = glm::translate(model, position);
-      model      = model * glm::mat4_cast(rotation);
-      model      = glm::scale(model, scale);
-      return model;
+    void setRotation(const glm::quat &rotation) {
+      m_rotation = rotation;
+      markDirty();
     }
 
     void setRotation(float pitch, float yaw, float roll) {
       auto qPitch = glm::angleAxis(pitch, LEFT);
       auto qYaw   = glm::angleAxis(yaw, UP);
       auto qRoll  = glm::angleAxis(roll, FRONT);
-      rotation    = qPitch * qYaw * qRoll;
+      setRotation(qPitch * qYaw * qRoll);
+    }
+
+    void setScale(const glm::vec3 &scale) {
+      m_scale = scale;
+      markDirty();
     }
 
+    void translate(const glm::vec3 &offset) { setPosition(m_position + offset); }
+
     void rotate(float pitch, float yaw, float roll) {
       auto qPitch = glm::angleAxis(pitch, LEFT);
       auto qYaw   = glm::angleAxis(yaw, UP);
       auto qRoll  = glm::angleAxis(roll, FRONT);
-      rotation *= qPitch * qYaw * qRoll;
+      setRotation(m_rotation * qPitch * qYaw * qRoll);
+    }
+
+  private:
+    friend class TransformBatch;
+
+    /** @brief Caches a model matrix calculated from this transform by a TransformBatch */
+    void setModelMatrix(const glm::mat4 &model) {
+      m_model   = model;
+      m_isDirty = false;
     }
 
-    glm::vec3 position;
-    glm::quat rotation;
-    glm::vec3 scale;
+    void markDirty() {
+      m_isDirty = true;
+      ++m_version;
+    }
+
+    glm::vec3 m_position;
+    glm::quat m_rotation;
+    glm::vec3 m_scale;
+    uint32_t m_version = 0;
+
+    mutable glm::mat4 m_model{1.f};
+    mutable bool m_isDirty = true;
   };
 } // namespace TritiumEngine::Core
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <TritiumEngine/Core/Components/Transform.hpp>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/quaternion.hpp>
+
+namespace TritiumEngine::Core
+{
+  /**
+   * @brief Keeps the state a Transform had at the start of the latest simulation step, so that
+   * rendering can interpolate between the last two simulation states
+   */
+  struct TransformHistory {
+    TransformHistory(const Transform &transform = Transform{}) { record(transform); }
+
+    void record(const Transform &transform) {
+      position = transform.getPosition();
+      rotation = transform.getRotation();
+      scale    = transform.getScale();
+      version  = transform.getVersion();
+    }
+
+    /** @brief Determines if the transform has not changed since its state was recorded */
+    bool isUnchanged(const Transform &current) const { return current.getVersion() == version; }
+
+    /**
+     * @brief Obtains the transform between the recorded and current state. Rotations are
+     * normalised linear interpolations along the shorter arc, matching TransformBatch.
+     * @param current The transform's state after the latest simulation step
+     * @param alpha Fraction of a simulation step elapsed since the latest step, from 0 to 1
+     */
+    Transform interpolate(const Transform &current, float alpha) const {
+      glm::quat target = current.getRotation();
+      if (glm::dot(rotation, target) < 0.f)
+        target = -target;
+
+      return Transform(glm::mix(position, current.getPosition(), alpha),
+                       glm::normalize(rotation * (1.f - alpha) + target * alpha),
+                       glm::mix(scale, current.getScale(), alpha));
+    }
+
+    glm::vec3 position;
+    glm::quat rotation;
+    glm::vec3 scale;
+    uint32_t version;
+  };
+} // namespace TritiumEngine::Core
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace TritiumEngine::Core
+{
+  /** @brief Tracks the number of unfinished jobs scheduled against it */
+  struct JobCounter {
+    std::atomic<int> pending = 0;
+  };
+
+  /**
+   * @brief Work-stealing thread pool. Every worker owns a queue it pushes to and pops from at the
+   * back, idle workers steal from the front of other queues. Threads waiting on jobs help run them
+   * rather than blocking, so jobs may safely schedule and wait on further jobs.
+   */
+  class JobSystem {
+  public:
+    using Job      = std::function<void()>;
+    using RangeJob = std::function<void(size_t begin, size_t end)>;
+
+    JobSystem(unsigned int nWorkers = std::thread::hardware_concurrency() - 1);
+    JobSystem(const JobSystem &)            = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+    ~JobSystem();
+
+    void schedule(Job job, JobCounter &counter);
+    void wait(const JobCounter &counter);
+    bool runPendingJob();
+
+    void parallelFor(size_t count, const RangeJob &job, size_t chunkSize = 0);
+
+    /**
+     * @brief Runs a function for every entity of an entt view, split into chunks across all
+     * threads. The function takes the same arguments as it would with view.each().
+     * @param view The view to iterate
+     * @param func Function called with the entity followed by its components
+     * @param chunkSize Number of entities per job, chosen automatically if 0
+     */
+    template <typename View, typename Func>
+    void parallelEach(const View &view, Func func, size_t chunkSize = 0) {
+      std::vector<typename View::entity_type> entities(view.begin(), view.end());
+      parallelFor(
+          entities.size(),
+          [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+              std::apply(func, std::tuple_cat(std::make_tuple(entities[i]), view.get(entities[i])));
+          },
+          chunkSize);
+    }
+
+    size_t getChunkSize(size_t count) const;
+    unsigned int getNumWorkers() const { return static_cast<unsigned int>(m_workers.size()); }
+
+  private:
+    constexpr static size_t MIN_CHUNK_SIZE    = 1024; // Keeps per-job overhead small
+    constexpr static size_t CHUNKS_PER_THREAD = 4;    // Spare chunks for idle threads to steal
+
+    struct QueuedJob {
+      Job job;
+      JobCounter *counter;
+    };
+
+    struct JobQueue {
+      std::mutex mutex;
+      std::deque<QueuedJob> jobs;
+    };
+
+    void workerLoop(unsigned int queueIndex);
+    bool tryRunJob(unsigned int queueIndex);
+    bool popJob(unsigned int queueIndex, QueuedJob &job);
+    bool stealJob(unsigned int queueIndex, QueuedJob &job);
+
+    // Queue used by the current thread, threads not owned by the job system share queue 0
+    static inline thread_local unsigned int s_queueIndex = 0;
+
+    std::vector<std::unique_ptr<JobQueue>> m_queues;
+    std::vector<std::thread> m_workers;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+    std::atomic<int> m_nQueuedJobs;
+    std::atomic<bool> m_isRunning;
+  };
+} // namespace TritiumEngine::Core
\ No newline at end of file
@@ -1,39 +1,85 @@
 #pragma once
 
+#include <TritiumEngine/Core/System.hpp>
+#include <TritiumEngine/Core/SystemScheduler.hpp>
 #include <TritiumEngine/Utilities/Logger.hpp>
 
+#include <entt/core/type_info.hpp>
+#include <entt/entity/entity.hpp>
+
+#include <limits>
+#include <memory>
+#include <unordered_map>
+
 using namespace TritiumEngine::Utilities;
 
 namespace TritiumEngine::Core
 {
   class Application;
-  class System;
 
   template <typename T>
   using IsSystemType = typename std::enable_if_t<std::is_base_of_v<System, T>, bool>;
 
+  /**
+   * @brief Stable reference to a system registered with a scene. Handles can be cached and resolve
+   * with an index and generation check, becoming invalid once the system is removed or the scene
+   * is unloaded.
+   * @tparam T Type of the referenced system
+   */
+  template <class T> struct SystemHandle {
+    constexpr static uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    uint32_t index      = INVALID_INDEX;
+    uint32_t generation = 0;
+
+    bool isNull() const { return index == INVALID_INDEX; }
+  };
+
   class Scene {
   public:
     Scene(const std::string &name, Application &app);
-    ~Scene();
+    virtual ~Scene();
 
     void load();
     void unload();
+    void fixedUpdate(float dt);
     void update(float dt);
 
     /**
      * @brief Registers a new system
      * @tparam T Type of system to register
      * @param Args Additional parameters required to construct the system
+     * @return Handle to the registered system, or a null handle if already registered
      */
-    template <class T, typename... Args, IsSystemType<T> = true> void addSystem(Args &&...args) {
-      if (hasSystem<T>()) {
-        Logger::warn("[Scene] System {} is already registered with this scene.", typeid(T).name());
-        return;
+    template <class T, typename... Args, IsSystemType<T> = true>
+    SystemHandle<T> addSystem(Args &&...args) {
+      entt::id_type type = entt::type_hash<T>::value();
+      if (m_slotIndices.contains(type)) {
+        Logger::warn("[Scene] System {} is already registered with this scene.",
+                     entt::type_name<T>::value());
+        return {};
+      }
+
+      // Reuse a slot freed by a removed system where possible
+      uint32_t index;
+      if (!m_freeSlots.empty()) {
+        index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+      } else {
+        index = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
       }
 
-      m_systems.emplace_back(std::make_unique<T>(std::forward<Args>(args)...));
-      m_systems.back()->setup(m_app);
+      SystemSlot &slot = m_slots[index];
+      slot.system      = std::make_unique<T>(std::forward<Args>(args)...);
+      slot.type        = type;
+      slot.generation  = ++m_generation;
+      m_slotIndices.emplace(type, index);
+      m_systemOrder.push_back(index);
+
+      slot.system->setup(m_app);
+      m_isScheduleDirty = true;
+      return {index, slot.generation};
     }
 
     /**
@@ -41,15 +87,15 @@ namespace TritiumEngine::Core
      * @tparam T Type of system to remove
      */
     template <class T, IsSystemType<T> = true> void removeSystem() {
-      auto it = std::find_if(m_systems.begin(), m_systems.end(),
-                             [&](const auto &s) { return dynamic_cast<T *>(s.get()) != nullptr; });
-      if (it == m_systems.end()) {
-        Logger::warn("[Scene] Could not remove system {} from this scene.", typeid(T).name());
+      auto it = m_slotIndices.find(entt::type_hash<T>::value());
+      if (it == m_slotIndices.end()) {
+        Logger::warn("[Scene] Could not remove system {} from this scene.",
+                     entt::type_name<T>::value());
         return;
       }
 
-      (*it)->dispose();
-      m_systems.erase(it);
+      releaseSlot(it->second);
+      m_slotIndices.erase(it);
     }
 
     /**
@@ -58,11 +104,7 @@ namespace TritiumEngine::Core
      * @return True if system type T is registered, false otherwise
      */
     template <class T, IsSystemType<T> = true> bool hasSystem() const {
-      for (auto &system : m_systems) {
-        if (dynamic_cast<T *>(system.get()))
-          return true;
-      }
-      return false;
+      return m_slotIndices.contains(entt::type_hash<T>::value());
     }
 
     /**
@@ -71,23 +113,68 @@ namespace TritiumEngine::Core
      * @return Pointer to system if successful, nullptr otherwise
      */
     template <class T, IsSystemType<T> = true> T *getSystem() const {
-      for (auto &system : m_systems) {
-        if (T *cast = dynamic_cast<T *>(system.get()))
-          return cast;
-      }
-      return nullptr;
+      auto it = m_slotIndices.find(entt::type_hash<T>::value());
+      return it != m_slotIndices.end() ? static_cast<T *>(m_slots[it->second].system.get())
+                                       : nullptr;
     }
 
+    /**
+     * @brief Resolves a system handle without any type lookup
+     * @tparam T The system type to obtain
+     * @return Pointer to system if the handle is still valid, nullptr otherwise
+     */
+    template <class T, IsSystemType<T> = true> T *getSystem(SystemHandle<T> handle) const {
+      if (handle.index >= m_slots.size())
+        return nullptr;
+
+      const SystemSlot &slot = m_slots[handle.index];
+      return slot.generation == handle.generation ? static_cast<T *>(slot.system.get())
+                                                  : nullptr;
+    }
+
+    /**
+     * @brief Obtains a handle to a registered system of type T
+     * @return Handle to the system, or a null handle if no such system is registered
+     */
+    template <class T, IsSystemType<T> = true> SystemHandle<T> getSystemHandle() const {
+      auto it = m_slotIndices.find(entt::type_hash<T>::value());
+      if (it == m_slotIndices.end())
+        return {};
+      return {it->second, m_slots[it->second].generation};
+    }
+
+    void logSchedule() const;
+
     const std::string name;
 
   protected:
     virtual void init() {}
     virtual void dispose() {}
     virtual void onUpdate(float dt) {}
+    virtual void runSystems(System::UpdatePhase phase, float dt);
+    virtual void clearSystems();
 
     Application &m_app;
 
   private:
-    std::vector<std::unique_ptr<System>> m_systems;
+    struct SystemSlot {
+      std::unique_ptr<System> system;
+      entt::id_type type  = 0;
+      uint32_t generation = 0;
+    };
+
+    void releaseSlot(uint32_t index);
+    void flushTransforms();
+    void buildSchedules();
+
+    std::vector<SystemSlot> m_slots;
+    std::vector<uint32_t> m_freeSlots;
+    std::vector<uint32_t> m_systemOrder; // Slot indices in registration order
+    std::unordered_map<entt::id_type, uint32_t> m_slotIndices;
+    std::vector<entt::entity> m_transformEntities;
+    uint32_t m_generation = 0;
+    SystemScheduler m_simulationScheduler;
+    SystemScheduler m_frameScheduler;
+    bool m_isScheduleDirty = true;
   };
 } // namespace TritiumEngine::Core
\ No newline at end of file
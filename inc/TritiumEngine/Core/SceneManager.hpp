@@ -27,8 +27,10 @@ namespace TritiumEngine::Core
     void loadScene(const std::string &name);
     void reloadCurrentScene();
 
+    void fixedUpdate(float dt) const;
     void update(float dt) const;
     bool hasScenes() const;
+    Scene *getCurrentScene() const;
 
     /**
      * @brief Adds a new scene
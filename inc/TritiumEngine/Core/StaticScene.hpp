@@ -0,0 +1,46 @@
+#pragma once
+
+#include <TritiumEngine/Core/Scene.hpp>
+#include <TritiumEngine/Core/SystemPipeline.hpp>
+
+#include <optional>
+
+namespace TritiumEngine::Core
+{
+  /**
+   * @brief Scene with a fixed set of systems known at compile time, run through a SystemPipeline
+   * after any systems added dynamically. The pipeline is created by setupPipeline() when the scene
+   * is initialised and destroyed along with the dynamic systems when it is unloaded.
+   * @tparam Systems Types of the systems in the pipeline
+   */
+  template <class... Systems> class StaticScene : public Scene {
+  public:
+    StaticScene(const std::string &name, Application &app) : Scene(name, app) {}
+
+  protected:
+    /**
+     * @brief Creates the pipeline systems, replacing any created before
+     * @param args One argument per system, in declaration order
+     */
+    template <typename... Args> void setupPipeline(Args &&...args) {
+      m_pipeline.emplace(std::forward<Args>(args)...);
+      m_pipeline->setup(m_app);
+    }
+
+    template <class T> T &getStaticSystem() { return m_pipeline->template get<T>(); }
+
+    void runSystems(System::UpdatePhase phase, float dt) override {
+      Scene::runSystems(phase, dt);
+      if (m_pipeline)
+        m_pipeline->update(phase, dt);
+    }
+
+    void clearSystems() override {
+      m_pipeline.reset();
+      Scene::clearSystems();
+    }
+
+  private:
+    std::optional<SystemPipeline<Systems...>> m_pipeline;
+  };
+} // namespace TritiumEngine::Core
\ No newline at end of file
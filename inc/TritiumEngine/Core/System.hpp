@@ -1,16 +1,72 @@
 #pragma once
 
+#include <entt/core/type_info.hpp>
+
+#include <string_view>
+#include <vector>
+
 namespace TritiumEngine::Core
 {
   class Application;
 
+  /** @brief Component type accessed by a system, used to find systems that may run concurrently */
+  struct ComponentAccess {
+    entt::id_type id;
+    std::string_view name;
+
+    template <typename Component> static ComponentAccess get() {
+      return {entt::type_hash<Component>::value(), entt::type_name<Component>::value()};
+    }
+  };
+
   class System {
   public:
+    /**
+     * @brief When a system is updated. Simulation systems tick at the application's fixed
+     * simulation rate, frame systems such as rendering run once every frame.
+     */
+    enum class UpdatePhase { SIMULATION, FRAME };
+
+    virtual ~System() = default;
     virtual void update(float dt) {}
 
     void setup(Application &app) { m_app = &app; }
 
+    /**
+     * @brief Determines if this system declared the components it accesses. Systems that did not
+     * are assumed to access everything and never run alongside other systems.
+     */
+    bool hasDeclaredAccess() const { return m_hasDeclaredAccess; }
+    bool isMainThreadOnly() const { return m_isMainThreadOnly; }
+    UpdatePhase getUpdatePhase() const { return m_updatePhase; }
+    const std::vector<ComponentAccess> &getReads() const { return m_reads; }
+    const std::vector<ComponentAccess> &getWrites() const { return m_writes; }
+
   protected:
+    /** @brief Declares component types this system only reads from */
+    template <typename... Components> void reads() {
+      (m_reads.push_back(ComponentAccess::get<Components>()), ...);
+      m_hasDeclaredAccess = true;
+    }
+
+    /** @brief Declares component types this system writes to */
+    template <typename... Components> void writes() {
+      (m_writes.push_back(ComponentAccess::get<Components>()), ...);
+      m_hasDeclaredAccess = true;
+    }
+
+    /** @brief Keeps this system on the main thread, required for anything touching OpenGL */
+    void setMainThreadOnly(bool mainThreadOnly = true) { m_isMainThreadOnly = mainThreadOnly; }
+
+    void setUpdatePhase(UpdatePhase updatePhase) { m_updatePhase = updatePhase; }
+
     Application *m_app;
+
+  private:
+    std::vector<ComponentAccess> m_reads;
+    std::vector<ComponentAccess> m_writes;
+    bool m_hasDeclaredAccess  = false;
+    bool m_isMainThreadOnly   = false;
+    UpdatePhase m_updatePhase = UpdatePhase::SIMULATION;
   };
-} // namespace TritiumEngine::Core
+} // namespace TritiumEngine::Core
\ No newline at end of file
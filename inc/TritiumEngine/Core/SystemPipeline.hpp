@@ -0,0 +1,60 @@
+#pragma once
+
+#include <TritiumEngine/Core/System.hpp>
+
+#include <tuple>
+#include <type_traits>
+
+namespace TritiumEngine::Core
+{
+  /**
+   * @brief Fixed set of systems stored by value. Systems are updated in declaration order with
+   * direct calls rather than through the vtable, letting the compiler inline across system
+   * boundaries. Systems in a pipeline run one after another on the calling thread.
+   * @tparam Systems Types of the systems in the pipeline
+   */
+  template <class... Systems> class SystemPipeline {
+    static_assert((std::is_base_of_v<System, Systems> && ...),
+                  "Pipeline members must derive from System");
+
+  public:
+    SystemPipeline() = default;
+
+    /**
+     * @brief Constructs every system from its matching argument
+     * @param args One argument per system, in declaration order
+     */
+    template <typename... Args, std::enable_if_t<sizeof...(Args) == sizeof...(Systems) &&
+                                                     sizeof...(Args) != 0,
+                                                 bool> = true>
+    explicit SystemPipeline(Args &&...args) : m_systems(std::forward<Args>(args)...) {}
+
+    void setup(Application &app) {
+      std::apply([&](Systems &...systems) { (systems.setup(app), ...); }, m_systems);
+    }
+
+    /**
+     * @brief Updates all systems belonging to the given update phase
+     * @param phase The update phase to run
+     * @param dt Time step for the phase
+     */
+    void update(System::UpdatePhase phase, float dt) {
+      std::apply([&](Systems &...systems) { (updateSystem(systems, phase, dt), ...); },
+                 m_systems);
+    }
+
+    template <class T> T &get() { return std::get<T>(m_systems); }
+    template <class T> const T &get() const { return std::get<T>(m_systems); }
+
+    constexpr static size_t size() { return sizeof...(Systems); }
+
+  private:
+    template <class T> static void updateSystem(T &system, System::UpdatePhase phase, float dt) {
+      // Qualified call is bound at compile time
+      if (system.getUpdatePhase() == phase)
+        system.T::update(dt);
+    }
+
+    std::tuple<Systems...> m_systems;
+  };
+} // namespace TritiumEngine::Core
\ No newline at end of file
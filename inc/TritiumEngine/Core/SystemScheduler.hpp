@@ -0,0 +1,53 @@
+#pragma once
+
+#include <TritiumEngine/Core/JobSystem.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace TritiumEngine::Core
+{
+  class System;
+
+  /**
+   * @brief Runs systems as a dependency graph. A system depends on every earlier registered system
+   * it conflicts with, i.e. where either writes a component the other accesses. Systems without
+   * conflicts run concurrently on the job system, while main thread only systems run on the
+   * calling thread in registration order.
+   */
+  class SystemScheduler {
+  public:
+    void build(const std::vector<System *> &systems);
+    void run(JobSystem &jobSystem, float dt);
+
+    std::string getScheduleDump() const;
+
+  private:
+    struct Node {
+      System *system;
+      std::vector<size_t> successors;
+      std::vector<size_t> predecessors;
+      float lastMs; // Duration of the system's last update
+    };
+
+    static bool isConflicting(const System &a, const System &b);
+
+    void launch(size_t index);
+    void execute(size_t index);
+    std::vector<size_t> getCriticalPath(float &totalMs) const;
+
+    std::vector<Node> m_nodes;
+
+    // State of the current run
+    std::unique_ptr<std::atomic<size_t>[]> m_remainingDependencies;
+    std::atomic<size_t> m_nFinished;
+    std::vector<size_t> m_readyMainThread;
+    std::mutex m_readyMutex;
+    JobCounter m_counter;
+    JobSystem *m_jobSystem = nullptr;
+    float m_dt             = 0.f;
+  };
+} // namespace TritiumEngine::Core
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <TritiumEngine/Core/Components/Transform.hpp>
+#include <TritiumEngine/Core/Components/TransformHistory.hpp>
+#include <TritiumEngine/Utilities/SimdUtils.hpp>
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+using namespace TritiumEngine::Utilities;
+
+namespace TritiumEngine::Core
+{
+  /**
+   * @brief Structure-of-arrays copy of a set of transforms. Every component of position, rotation
+   * and scale is packed into its own array so model matrices can be calculated for 4 (SSE4) or 8
+   * (AVX2) transforms at once. The widest instruction set supported at runtime is used by default.
+   * A batch can also be interpolated from a batch of previous states, so rendering in between two
+   * simulation states runs through the same vectorised kernels.
+   */
+  class TransformBatch {
+  public:
+    void clear();
+    void reserve(size_t count);
+    void push(const Transform &transform);
+    void push(const TransformHistory &history);
+
+    size_t size() const { return m_positionX.size(); }
+
+    glm::vec3 getPosition(size_t index) const;
+    glm::quat getRotation(size_t index) const;
+    glm::vec3 getScale(size_t index) const;
+
+    void interpolate(const TransformBatch &previous, float alpha);
+    void interpolate(const TransformBatch &previous, float alpha, SimdUtils::Level level);
+
+    void calcModelMatrices(glm::mat4 *models) const;
+    void calcModelMatrices(glm::mat4 *models, SimdUtils::Level level) const;
+
+    static void storeModelMatrices(const glm::mat4 *models, Transform *const *transforms,
+                                   size_t count);
+
+    static SimdUtils::Level getSimdLevel() { return s_simdLevel; }
+    static void setSimdLevel(SimdUtils::Level level);
+
+  private:
+    void interpolateScalar(const TransformBatch &previous, float alpha, size_t begin, size_t end);
+    size_t interpolateSse4(const TransformBatch &previous, float alpha);
+    size_t interpolateAvx2(const TransformBatch &previous, float alpha);
+    void calcScalar(glm::mat4 *models, size_t begin, size_t end) const;
+    size_t calcSse4(glm::mat4 *models) const;
+    size_t calcAvx2(glm::mat4 *models) const;
+
+    static inline SimdUtils::Level s_simdLevel = SimdUtils::GetSupportedLevel();
+
+    std::vector<float> m_positionX, m_positionY, m_positionZ;
+    std::vector<float> m_rotationX, m_rotationY, m_rotationZ, m_rotationW;
+    std::vector<float> m_scaleX, m_scaleY, m_scaleZ;
+  };
+} // namespace TritiumEngine::Core
\ No newline at end of file
@@ -1,12 +1,31 @@
 #pragma once
 
+#include <glm/glm.hpp>
+
 namespace TritiumEngine::Physics
 {
   class Collider {
   public:
-    void CheckCollision();
+    /**
+     * @brief Determines if two axis aligned boxes overlap, boxes that just touch count as colliding
+     * @param posA Center of the first box
+     * @param halfExtentsA Half width and height of the first box
+     * @param posB Center of the second box
+     * @param halfExtentsB Half width and height of the second box
+     */
+    static bool CheckCollision(const glm::vec2 &posA, const glm::vec2 &halfExtentsA,
+                               const glm::vec2 &posB, const glm::vec2 &halfExtentsB) {
+      glm::vec2 distance = glm::abs(posB - posA);
+      glm::vec2 extents  = halfExtentsA + halfExtentsB;
+      return distance.x <= extents.x && distance.y <= extents.y;
+    }
 
-  private:
-    
+    /**
+     * @brief Obtains how far two overlapping axis aligned boxes penetrate each other on each axis
+     */
+    static glm::vec2 GetPenetration(const glm::vec2 &posA, const glm::vec2 &halfExtentsA,
+                                    const glm::vec2 &posB, const glm::vec2 &halfExtentsB) {
+      return halfExtentsA + halfExtentsB - glm::abs(posB - posA);
+    }
   };
-}
\ No newline at end of file
+} // namespace TritiumEngine::Physics
\ No newline at end of file
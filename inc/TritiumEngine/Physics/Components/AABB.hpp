@@ -1,9 +1,17 @@
 #pragma once
 
+#include <glm/glm.hpp>
+
 namespace TritiumEngine::Physics
 {
+  /**
+   * @brief Axis aligned bounding box centered on the entity's position. Width and height are half
+   * extents, so a circle of radius r is bounded by AABB{r, r}.
+   */
   struct AABB {
-    float width;
-    float height;
+    float width;  // Half extent along x
+    float height; // Half extent along y
+
+    glm::vec2 getHalfExtents() const { return {width, height}; }
   };
-}
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <TritiumEngine/Utilities/SimdUtils.hpp>
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace TritiumEngine::Utilities;
+
+namespace TritiumEngine::Physics
+{
+  /**
+   * @brief Structure-of-arrays copy of the positions and velocities of a set of particles. Every
+   * component is packed into its own array so particles can be moved and reflected off the walls
+   * of a box 4 (SSE4) or 8 (AVX2) at a time. The widest instruction set supported at runtime is
+   * used by default.
+   */
+  class ParticleBatch {
+  public:
+    void resize(size_t count);
+
+    size_t size() const { return m_positionX.size(); }
+
+    /** @brief Copies the position and velocity of a particle into the batch */
+    void set(size_t index, const glm::vec3 &position, const glm::vec3 &velocity) {
+      m_positionX[index] = position.x;
+      m_positionY[index] = position.y;
+      m_positionZ[index] = position.z;
+      m_velocityX[index] = velocity.x;
+      m_velocityY[index] = velocity.y;
+      m_velocityZ[index] = velocity.z;
+    }
+
+    glm::vec3 getPosition(size_t index) const {
+      return {m_positionX[index], m_positionY[index], m_positionZ[index]};
+    }
+
+    glm::vec3 getVelocity(size_t index) const {
+      return {m_velocityX[index], m_velocityY[index], m_velocityZ[index]};
+    }
+
+    bool hasBounced(size_t index) const { return m_bounced[index] != 0; }
+
+    void reflectInBox(float halfBoxSize, float dt);
+    void reflectInBox(float halfBoxSize, float dt, SimdUtils::Level level);
+
+  private:
+    void reflectScalar(float halfBoxSize, float dt, size_t begin, size_t end);
+    size_t reflectSse4(float halfBoxSize, float dt);
+    size_t reflectAvx2(float halfBoxSize, float dt);
+
+    std::vector<float> m_positionX, m_positionY, m_positionZ;
+    std::vector<float> m_velocityX, m_velocityY, m_velocityZ;
+    std::vector<uint32_t> m_bounced; // Non-zero for particles that bounced off a wall
+  };
+} // namespace TritiumEngine::Physics
\ No newline at end of file
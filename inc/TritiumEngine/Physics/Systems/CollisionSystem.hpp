@@ -0,0 +1,86 @@
+#pragma once
+
+#include <TritiumEngine/Core/System.hpp>
+
+#include <entt/entity/entity.hpp>
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace TritiumEngine::Core;
+
+namespace TritiumEngine::Physics
+{
+  /**
+   * @brief Moves all entities with a Transform, Rigidbody and AABB and resolves collisions between
+   * them with elastic responses. Potentially colliding pairs are found by sorting bodies into a
+   * uniform grid, so the cell size should be at least twice the largest AABB half extent. All
+   * phases are split across the application's job system. Collisions are resolved in passes over
+   * cells at least 3 cells apart, so concurrently resolved pairs never share a body.
+   */
+  class CollisionSystem : public System {
+  public:
+    struct Stats {
+      float integrateMs   = 0.f; // Gathering bodies and integrating velocities
+      float broadphaseMs  = 0.f; // Sorting bodies into grid cells
+      float narrowphaseMs = 0.f; // Testing bodies in neighbouring cells for overlaps
+      float responseMs    = 0.f; // Resolving collisions and writing results back
+      size_t nBodies      = 0;
+      size_t nPairs       = 0;
+    };
+
+    CollisionSystem(const glm::vec2 &boundsMin, const glm::vec2 &boundsMax, float cellSize);
+
+    void update(float dt) override;
+
+    const Stats &getStats() const { return m_stats; }
+
+  private:
+    struct Body {
+      glm::vec2 position;
+      glm::vec2 halfExtents;
+      glm::vec2 velocity;
+      float inverseMass;
+    };
+
+    /** @brief Range of m_pairs found for the bodies of a single cell */
+    struct PairRange {
+      uint32_t start;
+      uint32_t end;
+    };
+
+    // Cells are resolved in one pass per combination of their coordinates modulo 3
+    constexpr static size_t N_RESOLVE_PASSES = 9;
+
+    using PassRanges = std::array<std::vector<PairRange>, N_RESOLVE_PASSES>;
+
+    void integrate(float dt);
+    void buildGrid();
+    void findPairs();
+    void resolvePairs();
+    void resolvePair(uint32_t i, uint32_t j);
+
+    uint32_t getCellIndex(const glm::vec2 &position) const;
+
+    glm::vec2 m_boundsMin;
+    glm::vec2 m_boundsMax;
+    float m_cellSize;
+    glm::ivec2 m_gridSize;
+
+    std::vector<entt::entity> m_entities;
+    std::vector<Body> m_bodies;
+    std::vector<uint32_t> m_bodyCells;   // Grid cell of each body
+    std::vector<uint32_t> m_cellStart;   // Index of first body of each cell in m_cellBodies
+    std::vector<uint32_t> m_cellCursors; // Next free index of each cell while sorting
+    std::vector<uint32_t> m_cellBodies;  // Body indices sorted by grid cell
+    std::vector<uint32_t> m_chunkCounts; // Bodies per chunk of cells, then their first index
+    std::vector<std::pair<uint32_t, uint32_t>> m_pairs;
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> m_chunkPairs; // Pairs found per job
+    std::vector<PassRanges> m_chunkRanges; // Pair ranges found per job, relative to its pairs
+    PassRanges m_passRanges;               // Pair ranges of all cells, by resolve pass
+    Stats m_stats;
+  };
+} // namespace TritiumEngine::Physics
\ No newline at end of file
@@ -1,17 +1,29 @@
 #pragma once
 
 #include <TritiumEngine/Core/Components/Transform.hpp>
+#include <TritiumEngine/Rendering/UniformBuffer.hpp>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <memory>
+
 using namespace TritiumEngine::Core;
 
 namespace TritiumEngine::Rendering
 {
+  /** @brief Layout of the 'CameraData' uniform block (std140) shared by all engine shaders */
+  struct CameraData {
+    glm::mat4 projection;
+    glm::mat4 view;
+    glm::mat4 projectionView;
+  };
+
   struct Camera {
     enum class Projection { ORTHOGRAPHIC, PERSPECTIVE };
 
+    constexpr static unsigned int UNIFORM_BINDING = 0;
+
     Camera(Projection projection, float frameWidth, float frameHeight,
            const Transform &transform = {}, float nearPlane = 0.1f, float farPlane = 100.f,
            float fov = glm::radians(60.f))
@@ -22,10 +34,12 @@ namespace TritiumEngine::Rendering
 
     glm::mat4 calcProjectionMatrix() const {
       if (projection == Projection::ORTHOGRAPHIC) {
-        float left   = transform.position.x - width * transform.scale.x * 0.5f;
-        float right  = transform.position.x + width * transform.scale.x * 0.5f;
-        float bottom = transform.position.y - height * transform.scale.y * 0.5f;
-        float top    = transform.position.y + height * transform.scale.y * 0.5f;
+        const auto &position = transform.getPosition();
+        const auto &scale    = transform.getScale();
+        float left           = position.x - width * scale.x * 0.5f;
+        float right          = position.x + width * scale.x * 0.5f;
+        float bottom         = position.y - height * scale.y * 0.5f;
+        float top            = position.y + height * scale.y * 0.5f;
         return glm::ortho(left, right, bottom, top, nearPlane, farPlane);
       } else {
         return glm::perspective(fov, getAspectRatio(), nearPlane, farPlane);
@@ -36,6 +50,10 @@ namespace TritiumEngine::Rendering
       return calcProjectionMatrix() * transform.getViewMatrix();
     }
 
+    const CameraData &getCameraData() const;
+    const glm::mat4 &getProjectionViewMatrix() const { return getCameraData().projectionView; }
+    void bindUniformBuffer() const;
+
     Projection projection;
     float width;
     float height;
@@ -43,5 +61,40 @@ namespace TritiumEngine::Rendering
     float nearPlane;
     float farPlane;
     float fov;
+
+  private:
+    // Camera properties the cached matrices were last calculated from
+    struct State {
+      Projection projection;
+      float width;
+      float height;
+      glm::vec3 position;
+      glm::quat rotation;
+      glm::vec3 scale;
+      float nearPlane;
+      float farPlane;
+      float fov;
+
+      bool operator==(const State &) const = default;
+    };
+
+    /**
+     * @brief Uniform buffer along with the camera state its contents were uploaded from. Copies of
+     * a camera share the buffer, so the upload state is kept with it rather than per camera.
+     */
+    struct Uniforms {
+      Uniforms() : buffer(sizeof(CameraData)) {}
+
+      UniformBuffer buffer;
+      State uploadedState{};
+      bool isUploaded = false;
+    };
+
+    State getState() const;
+
+    mutable State m_cachedState{};
+    mutable CameraData m_cachedData{};
+    mutable bool m_isCached = false;
+    mutable std::shared_ptr<Uniforms> m_uniforms;
   };
 } // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -1,51 +1,167 @@
 #pragma once
 
+#include <TritiumEngine/Rendering/Mesh.hpp>
 #include <TritiumEngine/Rendering/RenderData.hpp>
 
+#include <GL/glew.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/fwd.hpp>
 #include <glm/glm.hpp>
 
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 namespace TritiumEngine::Rendering
 {
   struct InstanceTag {
     uint32_t value;
   };
 
+  /**
+   * @brief Per-instance data format of an instanced renderable
+   * MAT4: full model matrix and color, 68 bytes per instance.
+   * COMPACT_2D: 2D position, scale and rotation angle and color, 24 bytes per instance.
+   * COMPACT_2D_HALF: 2D position, half-float scale and color without rotation, 16 bytes per
+   * instance.
+   * Compact layouts are expanded by the vertex shader, see instanced2d.vert.
+   */
+  enum class InstanceLayout { MAT4, COMPACT_2D, COMPACT_2D_HALF };
+
   struct InstanceData {
+    constexpr static InstanceLayout LAYOUT = InstanceLayout::MAT4;
+
     glm::mat4 model;
     uint32_t color;
   };
 
+  struct InstanceData2D {
+    constexpr static InstanceLayout LAYOUT = InstanceLayout::COMPACT_2D;
+
+    glm::vec2 position;
+    glm::vec2 scale;
+    float rotation; // radians, counter-clockwise
+    uint32_t color;
+  };
+
+  struct InstanceData2DHalf {
+    constexpr static InstanceLayout LAYOUT = InstanceLayout::COMPACT_2D_HALF;
+
+    glm::vec2 position;
+    uint32_t scale; // two half floats, see glm::packHalf2x16
+    uint32_t color;
+  };
+
   class InstancedRenderable {
   public:
-    InstancedRenderable(unsigned int renderMode, const RenderData &renderData, int count);
+    /**
+     * STAGED: instance data is written to a CPU-side copy and uploaded with every update.
+     * PERSISTENT: instance data is written straight into a persistently mapped buffer split into
+     * one region per frame in flight, guarded by fences.
+     */
+    enum class UploadMode { STAGED, PERSISTENT };
+
+    InstancedRenderable(unsigned int renderMode, const RenderData &renderData, int count,
+                        UploadMode uploadMode = UploadMode::STAGED,
+                        InstanceLayout layout = InstanceLayout::MAT4);
+    InstancedRenderable(unsigned int renderMode, std::shared_ptr<Mesh> mesh, int count,
+                        UploadMode uploadMode = UploadMode::STAGED,
+                        InstanceLayout layout = InstanceLayout::MAT4);
     InstancedRenderable(const InstancedRenderable &)            = delete;
     InstancedRenderable &operator=(const InstancedRenderable &) = delete;
     ~InstancedRenderable();
 
     void setInstanceData(size_t index, const InstanceData &data);
+    void setInstanceData(size_t index, const InstanceData2D &data);
+    void setInstanceData(size_t index, const InstanceData2DHalf &data);
     void resizeInstanceDataBuffer(size_t newSize);
     void updateInstanceDataBuffer() const;
+    void updateInstanceDataBuffer(size_t count) const;
+    void updateInstanceDataBuffer(size_t offset, size_t count) const;
 
+    /**
+     * @brief Starts writing a new frame of instance data, see beginRegionUpdate()
+     * @tparam T Instance data type, must match the instance layout of this renderable
+     * @return Pointer to where instance data for this frame should be written
+     */
+    template <typename T = InstanceData> T *beginInstanceDataUpdate() {
+      return reinterpret_cast<T *>(beginRegionUpdate());
+    }
+
+    unsigned int createVertexArray(unsigned int instanceBuffer) const;
+
+    void addInstance(entt::entity entity);
+    void removeInstance(entt::entity entity);
+    bool hasInstance(entt::entity entity) const;
+    const std::vector<entt::entity> &getInstances() const { return m_instances; }
+    bool tracksInstances() const { return m_tracksInstances; }
+    uint32_t getMembershipVersion() const { return m_membershipVersion; }
+
+    const std::shared_ptr<Mesh> &getMesh() const { return m_mesh; }
     unsigned int getVao() const { return m_vao; }
-    int getVertexStride() const { return m_vertexStride; }
-    int getNumVertices() const { return m_nVertices; }
-    int getNumIndices() const { return m_nIndices; }
+    unsigned int getInstanceBuffer() const { return m_ibo; }
+    int getVertexStride() const { return m_mesh->getVertexStride(); }
+    int getNumVertices() const { return m_mesh->getNumVertices(); }
+    int getNumIndices() const { return m_mesh->getNumIndices(); }
     int getNumInstances() const { return m_nInstances; }
     unsigned int getRenderMode() const { return m_renderMode; }
     uint32_t getInstanceId() const { return m_instanceId; }
+    UploadMode getUploadMode() const { return m_uploadMode; }
+    InstanceLayout getInstanceLayout() const { return m_layout; }
+    size_t getInstanceSize() const { return m_instanceSize; }
+    size_t getRegionOffset() const;
+
+    static size_t getLayoutSize(InstanceLayout layout);
+
+    static InstancedRenderable *find(entt::registry &registry, uint32_t instanceId);
+    static void connectInstanceTags(entt::registry &registry);
 
   private:
+    /** @brief Instance sets of a registry and their members, kept in the registry context */
+    struct InstanceSets {
+      std::unordered_map<uint32_t, entt::entity> owners;      // instance id -> owning entity
+      std::unordered_map<entt::entity, uint32_t> memberships; // member -> instance id
+    };
+
+    std::byte *beginRegionUpdate();
+    void setupInstanceAttributes(unsigned int vao) const;
+    void allocateInstanceDataBuffer();
+    void releaseInstanceDataBuffer();
+    void waitForRegion(int region);
+
+    static void onRenderableConstruct(entt::registry &registry, entt::entity entity);
+    static void onRenderableDestroy(entt::registry &registry, entt::entity entity);
+    static void onInstanceTagConstruct(entt::registry &registry, entt::entity entity);
+    static void onInstanceTagUpdate(entt::registry &registry, entt::entity entity);
+    static void onInstanceTagDestroy(entt::registry &registry, entt::entity entity);
+
+    constexpr static int N_BUFFERED_FRAMES         = 3;
+    constexpr static unsigned int INSTANCE_BINDING = 1;
+    constexpr static GLuint64 FENCE_TIMEOUT        = 1000000; // 1ms
+
+    std::shared_ptr<Mesh> m_mesh;
     unsigned int m_vao; // vertex array
-    unsigned int m_vbo; // vertex buffer
-    unsigned int m_ebo; // edges buffer
     unsigned int m_ibo; // instance data buffer
 
     int m_nInstances;
-    int m_vertexStride;
-    int m_nVertices;
-    int m_nIndices;
     unsigned int m_renderMode;
     uint32_t m_instanceId;
-    std::vector<InstanceData> m_instanceData;
+    UploadMode m_uploadMode;
+    InstanceLayout m_layout;
+    size_t m_instanceSize; // bytes per instance for the layout
+
+    std::vector<std::byte> m_instanceData; // staging copy, unused with persistent uploads
+    std::byte *m_mappedData;               // start of the persistently mapped buffer
+    std::byte *m_writeData;                // where instance data is currently written to
+    int m_region;                          // mapped region currently written to
+    std::array<GLsync, N_BUFFERED_FRAMES> m_fences;
+
+    std::vector<entt::entity> m_instances;                      // dense list of set members
+    std::unordered_map<entt::entity, size_t> m_instanceIndices; // member -> index in m_instances
+    bool m_tracksInstances = false; // set once the first member is added, even if all are removed
+
+    uint32_t m_membershipVersion = 0; // incremented whenever members are added or removed
   };
-} // namespace TritiumEngine::Rendering
\ No newline at end of file
+} // namespace TritiumEngine::Rendering
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <string>
+
+namespace TritiumEngine::Rendering
+{
+  /**
+   * @brief Picks a level of detail from measured frame times, so that rendering holds a target
+   * frame time regardless of the machine. Level 0 is the most detailed, higher levels are cheaper.
+   * Levels only change once the smoothed frame time stayed outside the hysteresis band around the
+   * target for the settle time. Levels are updated by LodSystem and mapped to actual detail by the
+   * render system owning the policy. Frame times are capped a few times above the target and the
+   * first frames after creation are ignored, so a single load stall can't change the level.
+   */
+  class LodPolicy {
+  public:
+    LodPolicy(const std::string &name, int nLevels, float targetFrameMs = 1000.f / 60.f,
+              int initialLevel = 0);
+
+    bool addFrameTime(float frameMs, float dt);
+
+    const std::string &getName() const { return m_name; }
+    int getLevel() const { return m_level; }
+    int getPreviousLevel() const { return m_previousLevel; }
+    int getNumLevels() const { return m_nLevels; }
+    int getNumTransitions() const { return m_nTransitions; }
+    float getAverageFrameMs() const { return m_averageFrameMs; }
+    float getTargetFrameMs() const { return m_targetFrameMs; }
+
+    float hysteresis = 0.15f; // Fraction of the target frame time ignored around the target
+    float settleTime = 0.5f;  // Seconds a frame time must persist before changing levels
+    float smoothing  = 0.1f;  // Weight of the latest frame time in the average
+
+  private:
+    constexpr static float MAX_REFINE_BACKOFF    = 16.f;
+    constexpr static float MAX_FRAME_TIME_FACTOR = 4.f; // Frame times are capped at this x target
+    constexpr static int WARMUP_FRAMES           = 3;   // Frames ignored after creation
+
+    std::string m_name;
+    int m_nLevels;
+    float m_targetFrameMs;
+    int m_level;
+    int m_previousLevel;
+    int m_nTransitions  = 0;
+    int m_nWarmupFrames = WARMUP_FRAMES;
+    float m_averageFrameMs;
+    float m_overBudgetTime  = 0.f;
+    float m_underBudgetTime = 0.f;
+    float m_refineBackoff   = 1.f; // Multiplies the settle time before refining
+  };
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
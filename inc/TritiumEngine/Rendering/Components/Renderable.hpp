@@ -1,29 +1,26 @@
 #pragma once
 
+#include <TritiumEngine/Rendering/Mesh.hpp>
 #include <TritiumEngine/Rendering/RenderData.hpp>
 
+#include <memory>
+
 namespace TritiumEngine::Rendering
 {
   class Renderable {
   public:
     Renderable(unsigned int renderMode, const RenderData &renderData);
-    Renderable(const Renderable &)            = delete;
-    Renderable &operator=(const Renderable &) = delete;
-    ~Renderable();
+    Renderable(unsigned int renderMode, std::shared_ptr<Mesh> mesh);
 
-    unsigned int getVao() const { return m_vao; }
-    int getVertexStride() const { return m_vertexStride; }
-    int getNumVertices() const { return m_nVertices; }
-    int getNumIndices() const { return m_nIndices; }
+    const std::shared_ptr<Mesh> &getMesh() const { return m_mesh; }
+    unsigned int getVao() const { return m_mesh->getVao(); }
+    int getVertexStride() const { return m_mesh->getVertexStride(); }
+    int getNumVertices() const { return m_mesh->getNumVertices(); }
+    int getNumIndices() const { return m_mesh->getNumIndices(); }
     unsigned int getRenderMode() const { return m_renderMode; }
 
   private:
-    unsigned int m_vao;
-    unsigned int m_vbo;
-    unsigned int m_ebo;
-    int m_vertexStride;
-    int m_nVertices;
-    int m_nIndices;
+    std::shared_ptr<Mesh> m_mesh;
     unsigned int m_renderMode;
   };
 } // namespace TritiumEngine::Rendering
\ No newline at end of file
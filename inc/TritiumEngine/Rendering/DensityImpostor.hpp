@@ -0,0 +1,56 @@
+#pragma once
+
+#include <TritiumEngine/Rendering/Components/Texture.hpp>
+#include <TritiumEngine/Rendering/ShaderManager.hpp>
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace TritiumEngine::Rendering
+{
+  /**
+   * @brief Stands in for many tiny instances with a low resolution texture covering the screen.
+   * Instances are splatted into the texel under their center, accumulating their color weighted by
+   * area, and the texture is drawn as a single quad. Texels are as opaque as the fraction of their
+   * area the instances cover, so the cost of drawing only depends on the resolution.
+   * Requires the "screen" shader.
+   */
+  class DensityImpostor {
+  public:
+    DensityImpostor(ShaderManager &shaderManager);
+    DensityImpostor(const DensityImpostor &)            = delete;
+    DensityImpostor &operator=(const DensityImpostor &) = delete;
+    ~DensityImpostor();
+
+    void resize(int width, int height);
+    void clear();
+    void upload(float texelArea);
+    void draw() const;
+
+    /**
+     * @brief Adds an instance to a texel. Texels are independent, so instances may be splatted
+     * from several threads as long as no two threads write the same texel.
+     */
+    void splat(int x, int y, uint32_t color, float area) {
+      glm::vec4 &texel = m_accumulation[static_cast<size_t>(y) * m_size.x + x];
+      texel += glm::vec4(color & 0xFF, (color >> 8) & 0xFF, (color >> 16) & 0xFF, 1.f) * area;
+    }
+
+    const glm::ivec2 &getSize() const { return m_size; }
+
+  private:
+    ShaderManager &m_shaderManager;
+    ShaderId m_shader;
+
+    glm::ivec2 m_size;
+    std::unique_ptr<Texture> m_texture;
+    std::vector<glm::vec4> m_accumulation; // color times area and area of each texel
+    std::vector<uint32_t> m_pixels;        // resolved RGBA texels
+
+    unsigned int m_quadVao;
+    unsigned int m_quadVbo;
+  };
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
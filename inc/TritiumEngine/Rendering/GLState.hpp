@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace TritiumEngine::Rendering
+{
+  /**
+   * @brief Engine-side shadow of commonly changed OpenGL state. All state changes made through this
+   * class are skipped if they would not change the current state, avoiding redundant driver calls
+   * and synchronous state queries. State changed directly through OpenGL bypasses the cache and
+   * must be followed by a call to invalidate().
+   */
+  class GLState {
+  public:
+    static void setDepthTest(bool enable);
+    static void setDepthFunc(unsigned int func);
+    static void setBlend(bool enable);
+    static void setBlendFunc(unsigned int sFactor, unsigned int dFactor);
+
+    static void useProgram(unsigned int program);
+    static void bindVertexArray(unsigned int vao);
+    static void bindBuffer(unsigned int target, unsigned int buffer);
+    static void bindBufferBase(unsigned int target, unsigned int index, unsigned int buffer);
+    static void activeTexture(unsigned int unit);
+    static void bindTexture(unsigned int target, unsigned int texture);
+
+    static void deleteProgram(unsigned int program);
+    static void deleteVertexArray(unsigned int vao);
+    static void deleteBuffer(unsigned int buffer);
+    static void deleteTexture(unsigned int texture);
+
+    static void invalidate();
+    static void newFrame();
+
+    static unsigned int getCurrentProgram() { return s_program; }
+    static unsigned int getCurrentVertexArray() { return s_vao; }
+    static int getAvoidedChanges() { return s_lastAvoidedChanges; }
+    static int getAppliedChanges() { return s_lastAppliedChanges; }
+
+  private:
+    constexpr static unsigned int UNKNOWN = ~0u;
+
+    static bool shouldChange(unsigned int &current, unsigned int value);
+    static uint64_t makeKey(unsigned int a, unsigned int b) { return (uint64_t)a << 32 | b; }
+
+    static inline unsigned int s_depthTest    = UNKNOWN;
+    static inline unsigned int s_depthFunc    = UNKNOWN;
+    static inline unsigned int s_blend        = UNKNOWN;
+    static inline unsigned int s_blendSFactor = UNKNOWN;
+    static inline unsigned int s_blendDFactor = UNKNOWN;
+    static inline unsigned int s_program      = UNKNOWN;
+    static inline unsigned int s_vao          = UNKNOWN;
+    static inline unsigned int s_activeUnit   = UNKNOWN;
+
+    static inline std::unordered_map<unsigned int, unsigned int> s_buffers;    // target -> buffer
+    static inline std::unordered_map<uint64_t, unsigned int> s_indexedBuffers; // target, index
+    static inline std::unordered_map<uint64_t, unsigned int> s_textures;       // unit, target
+
+    static inline int s_avoidedChanges     = 0;
+    static inline int s_appliedChanges     = 0;
+    static inline int s_lastAvoidedChanges = 0;
+    static inline int s_lastAppliedChanges = 0;
+  };
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
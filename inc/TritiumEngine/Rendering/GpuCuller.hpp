@@ -0,0 +1,69 @@
+#pragma once
+
+#include <TritiumEngine/Rendering/Components/InstancedRenderable.hpp>
+#include <TritiumEngine/Rendering/ShaderManager.hpp>
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TritiumEngine::Rendering
+{
+  /**
+   * @brief Culls the instances of an instanced renderable against a camera frustum on the GPU. A
+   * compute shader tests the bounding sphere of each instance, appends survivors to an output
+   * buffer and counts them in an indirect draw command, so visibility never reaches the CPU.
+   * Requires OpenGL 4.3 and the "frustum_cull" compute shader.
+   */
+  class GpuCuller {
+  public:
+    constexpr static unsigned int WORK_GROUP_SIZE = 256; // local_size_x of the compute shader
+
+    GpuCuller(ShaderManager &shaderManager, float boundingRadius = 1.f);
+    GpuCuller(const GpuCuller &)            = delete;
+    GpuCuller &operator=(const GpuCuller &) = delete;
+    ~GpuCuller();
+
+    void begin(const InstancedRenderable &renderable, const glm::mat4 &projectionView);
+    void cull(uint32_t firstInstance, uint32_t count);
+    void draw(const InstancedRenderable &renderable) const;
+
+    static bool isSupported();
+
+  private:
+    /** @brief Shared prefix of DrawArraysIndirectCommand and DrawElementsIndirectCommand */
+    struct DrawCommand {
+      uint32_t count;
+      uint32_t instanceCount;
+      uint32_t first;
+      int32_t baseVertex; // base instance for array draws
+      uint32_t baseInstance;
+    };
+
+    constexpr static unsigned int SOURCE_BINDING  = 0;
+    constexpr static unsigned int CULLED_BINDING  = 1;
+    constexpr static unsigned int COMMAND_BINDING = 2;
+
+    void allocateCulledBuffer(const InstancedRenderable &renderable);
+    void releaseCulledBuffer();
+
+    ShaderManager &m_shaderManager;
+    ShaderId m_shader;
+    float m_boundingRadius;
+
+    unsigned int m_culledBuffer;  // instances surviving the cull
+    unsigned int m_commandBuffer; // indirect draw command
+    unsigned int m_vao;           // draws the renderable's mesh with culled instances
+    size_t m_capacity;            // bytes held by the culled buffer
+    uint32_t m_instanceId;        // renderable the vertex array was created for
+    uint32_t m_regionOffset;      // first instance of the source region being culled
+
+    Uniform<glm::vec4> m_planesUniform;
+    Uniform<unsigned int> m_firstInstanceUniform;
+    Uniform<unsigned int> m_nInstancesUniform;
+    Uniform<unsigned int> m_instanceWordsUniform;
+    Uniform<unsigned int> m_instanceLayoutUniform;
+    Uniform<float> m_boundingRadiusUniform;
+  };
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <TritiumEngine/Rendering/RenderData.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace TritiumEngine::Rendering
+{
+  class Mesh {
+  public:
+    Mesh(const RenderData &renderData);
+    Mesh(const Mesh &)            = delete;
+    Mesh &operator=(const Mesh &) = delete;
+    ~Mesh();
+
+    static std::shared_ptr<Mesh> get(const RenderData &renderData);
+    static std::shared_ptr<Mesh> get(const std::string &name, const RenderData &renderData);
+    static std::shared_ptr<Mesh> find(const std::string &name);
+
+    unsigned int getVao() const { return m_vao; }
+    unsigned int getVbo() const { return m_vbo; }
+    unsigned int getEbo() const { return m_ebo; }
+    int getVertexStride() const { return m_vertexStride; }
+    int getNumVertices() const { return m_nVertices; }
+    int getNumIndices() const { return m_nIndices; }
+
+  private:
+    struct CacheEntry {
+      RenderData renderData;
+      std::weak_ptr<Mesh> mesh;
+    };
+
+    static size_t hashRenderData(const RenderData &renderData);
+    static bool isEqual(const RenderData &a, const RenderData &b);
+
+    static inline std::unordered_multimap<size_t, CacheEntry> s_contentCache;
+    static inline std::unordered_map<std::string, std::weak_ptr<Mesh>> s_namedCache;
+
+    unsigned int m_vao; // vertex array
+    unsigned int m_vbo; // vertex buffer
+    unsigned int m_ebo; // edges buffer
+    int m_vertexStride;
+    int m_nVertices;
+    int m_nIndices;
+  };
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <TritiumEngine/Rendering/GLState.hpp>
+
 #include <GL/glew.h>
 
 namespace TritiumEngine::Rendering
@@ -13,24 +15,14 @@ namespace TritiumEngine::Rendering
 
     void apply() const {
       // Apply depth test
-      bool depthPrevEnabled = glIsEnabled(GL_DEPTH_TEST);
-      if (enableDepthTest) {
-        glDepthFunc(depthFunc);
-        if (!depthPrevEnabled)
-          glEnable(GL_DEPTH_TEST);
-      } else if (depthPrevEnabled) {
-        glDisable(GL_DEPTH_TEST);
-      }
+      GLState::setDepthTest(enableDepthTest);
+      if (enableDepthTest)
+        GLState::setDepthFunc(depthFunc);
 
       // Apply blend
-      bool blendPrevEnabled = glIsEnabled(GL_BLEND);
-      if (enableBlend) {
-        glBlendFunc(blendSFactor, blendDFactor);
-        if (!blendPrevEnabled)
-          glEnable(GL_BLEND);
-      } else if (blendPrevEnabled) {
-        glDisable(GL_BLEND);
-      }
+      GLState::setBlend(enableBlend);
+      if (enableBlend)
+        GLState::setBlendFunc(blendSFactor, blendDFactor);
     }
   };
 } // namespace TritiumEngine::Rendering
\ No newline at end of file
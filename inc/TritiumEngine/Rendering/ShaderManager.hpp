@@ -4,23 +4,49 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace TritiumEngine::Rendering
 {
   typedef unsigned int ShaderId;
 
+  /**
+   * @brief Handle to a uniform location within a specific shader program, resolved once and reused
+   * when setting the uniform. A location of -1 denotes an inactive or unknown uniform and is
+   * silently ignored when set.
+   * @tparam T Type of value held by the uniform
+   */
+  template <typename T> struct Uniform {
+    int location = -1;
+
+    bool isValid() const { return location != -1; }
+  };
+
   class ShaderManager {
   public:
     ~ShaderManager();
 
     ShaderId create(const std::string &name, const std::string &vertexData,
-                    const std::string &fragmentData, const std::string &geometryData,
-                    const std::string &computeData);
+                    const std::string &fragmentData, const std::string &geometryData);
+    ShaderId createCompute(const std::string &name, const std::string &computeData);
     ShaderId get(const std::string &name, bool reload = false);
     void use(ShaderId id);
     void use(const std::string &name, bool reload = false);
     ShaderId getCurrentShader() const { return m_currentShaderId; }
 
+    int getUniformLocation(ShaderId id, const std::string &name) const;
+    void setUniformBlockBinding(const std::string &blockName, unsigned int binding);
+
+    /**
+     * @brief Obtains a typed handle to a uniform of the given shader program
+     * @tparam T Type of value held by the uniform
+     * @param id The id of the shader program holding the uniform
+     * @param name Name of the uniform
+     */
+    template <typename T> Uniform<T> getUniform(ShaderId id, const std::string &name) const {
+      return Uniform<T>{getUniformLocation(id, name)};
+    }
+
     // Shader parameter setter methods
     void setBool(const std::string &name, bool value) const;
     void setInt(const std::string &name, int value) const;
@@ -36,11 +62,31 @@ namespace TritiumEngine::Rendering
     void setMatrix3(const std::string &name, const glm::mat3 &value) const;
     void setMatrix4(const std::string &name, const glm::mat4 &value) const;
 
+    // Shader parameter setter methods using resolved uniform handles
+    void setBool(Uniform<bool> uniform, bool value) const;
+    void setInt(Uniform<int> uniform, int value) const;
+    void setUint(Uniform<unsigned int> uniform, unsigned int value) const;
+    void setFloat(Uniform<float> uniform, float value) const;
+    void setVector2(Uniform<glm::vec2> uniform, const glm::vec2 &value) const;
+    void setVector3(Uniform<glm::vec3> uniform, const glm::vec3 &value) const;
+    void setVector4(Uniform<glm::vec4> uniform, const glm::vec4 &value) const;
+    void setMatrix2(Uniform<glm::mat2> uniform, const glm::mat2 &value) const;
+    void setMatrix3(Uniform<glm::mat3> uniform, const glm::mat3 &value) const;
+    void setMatrix4(Uniform<glm::mat4> uniform, const glm::mat4 &value) const;
+    void setVector4Array(Uniform<glm::vec4> uniform, const glm::vec4 *values, int count) const;
+
   private:
     ShaderId compile(const char *shaderCode, unsigned int shaderType);
     ShaderId link(const std::vector<ShaderId> &shaderPrograms);
+    void reflectUniforms(ShaderId program);
+    void bindUniformBlocks(ShaderId program) const;
+
+    using UniformLocationMap = std::unordered_map<std::string, int>;
 
     std::unordered_map<std::string, ShaderId> m_nameToIdMap;
+    // Also caches names looked up after linking, which happens from const getters
+    mutable std::unordered_map<ShaderId, UniformLocationMap> m_uniformLocations;
+    std::unordered_map<std::string, unsigned int> m_uniformBlockBindings;
     ShaderId m_currentShaderId = 0;
   };
 } // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <TritiumEngine/Rendering/Components/Camera.hpp>
 #include <TritiumEngine/Rendering/Components/InstancedRenderable.hpp>
 #include <TritiumEngine/Rendering/Components/Shader.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
 #include <TritiumEngine/Rendering/Systems/RenderSystem.hpp>
 #include <TritiumEngine/Utilities/ColorUtils.hpp>
 
@@ -11,38 +12,56 @@ namespace TritiumEngine::Rendering
   template <uint32_t CameraTag> class InstancedRenderSystem : public RenderSystem<CameraTag> {
   public:
     InstancedRenderSystem(RenderSettings renderOptions = {})
-        : RenderSystem<CameraTag>(renderOptions) {}
+        : RenderSystem<CameraTag>(renderOptions) {
+      RenderSystem<CameraTag>::template reads<Shader, Transform, Color>();
+      RenderSystem<CameraTag>::template writes<InstancedRenderable>();
+    }
 
     void draw(const Camera &camera) const override {
       auto &shaderManager = RenderSystem<CameraTag>::m_app->shaderManager;
       auto &registry      = RenderSystem<CameraTag>::m_app->registry;
+      auto instanceView   = registry.view<Transform, Color>();
 
       registry.view<InstancedRenderable, Shader>().each(
           [&](auto entity, InstancedRenderable &renderable, Shader &shader) {
+            if (shader.id != shaderManager.getCurrentShader())
+              shaderManager.use(shader.id);
+
+            // Update model matrices and color, visiting only the members of this instance set.
+            // Renderables without tracked members draw whatever their buffer was filled with
+            const auto &instances = renderable.getInstances();
+            bool isTracked        = renderable.tracksInstances();
+            int nInstances        = isTracked ? static_cast<int>(instances.size())
+                                              : renderable.getNumInstances();
+            if (nInstances == 0)
+              return;
+
+            if (isTracked) {
+              if (instances.size() > static_cast<size_t>(renderable.getNumInstances()))
+                renderable.resizeInstanceDataBuffer(instances.size());
+
+              switch (renderable.getInstanceLayout()) {
+              case InstanceLayout::MAT4:
+                writeInstances<InstanceData>(renderable, instanceView);
+                break;
+              case InstanceLayout::COMPACT_2D:
+                writeInstances<InstanceData2D>(renderable, instanceView);
+                break;
+              case InstanceLayout::COMPACT_2D_HALF:
+                writeInstances<InstanceData2DHalf>(renderable, instanceView);
+                break;
+              }
+              renderable.updateInstanceDataBuffer(instances.size());
+            }
+
             unsigned int vao        = renderable.getVao();
             int vertexStride        = renderable.getVertexStride();
             int nVertices           = renderable.getNumVertices();
             int nIndices            = renderable.getNumIndices();
-            int nInstances          = renderable.getNumInstances();
             unsigned int renderMode = renderable.getRenderMode();
-            uint32_t instanceId     = renderable.getInstanceId();
-
-            if (shader.id != shaderManager.getCurrentShader()) {
-              shaderManager.use(shader.id);
-              shaderManager.setMatrix4("projectionView", camera.calcProjectionViewMatrix());
-            }
-
-            // Update model matrices and color
-            int index = 0;
-            registry.view<Transform, Color, InstanceTag>().each(
-                [&](auto entity, Transform &transform, Color &color, InstanceTag &tag) {
-                  if (tag.value == instanceId)
-                    renderable.setInstanceData(index++, {transform.getModelMatrix(), color.value});
-                });
-            renderable.updateInstanceDataBuffer();
 
             // Draw the renderable
-            glBindVertexArray(vao);
+            GLState::bindVertexArray(vao);
             if (nIndices > 0)
               glDrawElementsInstanced(renderMode, nIndices, GL_UNSIGNED_INT, 0, nInstances);
             else
@@ -50,5 +69,21 @@ namespace TritiumEngine::Rendering
           });
       shaderManager.use(0);
     }
+
+  private:
+    /**
+     * @brief Writes the data of every instance straight into the buffer region for this frame.
+     * Jobs convert separate ranges of instances, see RenderSystem::writeInstanceData()
+     */
+    template <typename T, typename View>
+    void writeInstances(InstancedRenderable &renderable, const View &instanceView) const {
+      const auto &instances = renderable.getInstances();
+      T *instanceData       = renderable.beginInstanceDataUpdate<T>();
+      RenderSystem<CameraTag>::m_app->jobSystem.parallelFor(
+          instances.size(), [&](size_t begin, size_t end) {
+            RenderSystem<CameraTag>::writeInstanceData(&instances[begin], end - begin, instanceView,
+                                                       &instanceData[begin]);
+          });
+    }
   };
 } // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <TritiumEngine/Core/System.hpp>
+
+using namespace TritiumEngine::Core;
+
+namespace TritiumEngine::Rendering
+{
+  /**
+   * @brief Feeds the duration of every frame to all LodPolicy components and logs their level
+   * changes. Should be added before the render systems reading the policies.
+   */
+  class LodSystem : public System {
+  public:
+    LodSystem();
+
+    void update(float dt) override;
+  };
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -1,32 +1,162 @@
 #pragma once
 
 #include <TritiumEngine/Core/Application.hpp>
+#include <TritiumEngine/Core/Components/Transform.hpp>
+#include <TritiumEngine/Core/Components/TransformHistory.hpp>
 #include <TritiumEngine/Core/System.hpp>
+#include <TritiumEngine/Core/TransformBatch.hpp>
+#include <TritiumEngine/Rendering/Components/Camera.hpp>
+#include <TritiumEngine/Rendering/Components/Color.hpp>
+#include <TritiumEngine/Rendering/Components/InstancedRenderable.hpp>
 #include <TritiumEngine/Rendering/RenderSettings.hpp>
 
 #include <entt/core/type_traits.hpp>
+#include <glm/gtc/packing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 using namespace TritiumEngine::Core;
 
 namespace TritiumEngine::Rendering
 {
-  struct Camera;
-
   template <uint32_t CameraTag> class RenderSystem : public System {
   public:
-    RenderSystem(RenderSettings renderSettings) : System(), m_renderSettings(renderSettings) {}
+    RenderSystem(RenderSettings renderSettings) : System(), m_renderSettings(renderSettings) {
+      // Rendering issues OpenGL calls, which must all come from the thread owning the context
+      setMainThreadOnly();
+      setUpdatePhase(UpdatePhase::FRAME);
+      reads<Camera, TransformHistory>();
+    }
 
     void update(float dt) override {
+      m_historyView        = m_app->registry.view<TransformHistory>();
+      m_interpolationAlpha = m_app->getInterpolationAlpha();
+
       m_renderSettings.apply();
       m_app->registry.view<Camera, entt::tag<CameraTag>>().each(
-          [&](auto entity, Camera &camera) { draw(camera); });
+          [&](auto entity, Camera &camera) {
+            camera.bindUniformBuffer();
+            draw(camera);
+          });
     }
 
     void setBlendOptions(RenderSettings renderSettings) { m_renderSettings = renderSettings; }
 
     virtual void draw(const Camera &camera) const = 0;
 
+  protected:
+    /**
+     * @brief Obtains the model matrix to render an entity with. Entities with a TransformHistory
+     * are interpolated between their last two simulation states, unless they have not moved.
+     */
+    glm::mat4 getModelMatrix(entt::entity entity, const Transform &transform) const {
+      Transform interpolated;
+      return getRenderTransform(entity, transform, interpolated).getModelMatrix();
+    }
+
+    /**
+     * @brief Obtains the transform to render an entity with, see getModelMatrix()
+     * @param interpolated Storage for the interpolated transform, if one is needed
+     * @return Either the entity's transform or the interpolated one
+     */
+    const Transform &getRenderTransform(entt::entity entity, const Transform &transform,
+                                        Transform &interpolated) const {
+      if (!m_historyView.contains(entity))
+        return transform;
+
+      const auto &history = m_historyView.template get<TransformHistory>(entity);
+      if (history.isUnchanged(transform))
+        return transform;
+
+      interpolated = history.interpolate(transform, m_interpolationAlpha);
+      return interpolated;
+    }
+
+    /**
+     * @brief Writes the per-instance data to render entities with, in the format of the given
+     * instance data type. Transforms are gathered into a TransformBatch, interpolated inside it
+     * and converted with its SIMD kernels, rather than one entity at a time. Compact 2D layouts
+     * only keep the rotation around the z axis.
+     * @tparam T One of InstanceData, InstanceData2D or InstanceData2DHalf
+     * @param entities Entities to write the data of, each with a Transform and Color
+     * @param count Number of entities
+     * @param view View providing Transform and Color for every entity
+     * @param out Where the data of each entity is written
+     * @return True if any entity was rendered in between its last two simulation states
+     */
+    template <typename T, typename View>
+    bool writeInstanceData(const entt::entity *entities, size_t count, const View &view,
+                           T *out) const {
+      thread_local TransformBatch current;
+      thread_local TransformBatch previous;
+      thread_local std::vector<uint32_t> colors;
+      thread_local std::vector<glm::mat4> models;
+
+      bool hasInterpolated = false;
+
+      // Batches stay small enough to remain in cache between gathering and converting
+      for (size_t begin = 0; begin < count; begin += INSTANCE_BATCH_SIZE) {
+        size_t end = std::min(begin + INSTANCE_BATCH_SIZE, count);
+
+        current.clear();
+        previous.clear();
+        colors.clear();
+        bool isBatchInterpolated = false;
+        for (size_t i = begin; i < end; ++i) {
+          const auto &[transform, color] = view.template get<Transform, Color>(entities[i]);
+          current.push(transform);
+          colors.push_back(color.value);
+
+          // Entities at rest are interpolated from their current state, which leaves them as is
+          const auto *history = m_historyView.contains(entities[i])
+                                    ? &m_historyView.template get<TransformHistory>(entities[i])
+                                    : nullptr;
+          if (history && !history->isUnchanged(transform)) {
+            previous.push(*history);
+            isBatchInterpolated = true;
+          } else {
+            previous.push(transform);
+          }
+        }
+
+        if (isBatchInterpolated)
+          current.interpolate(previous, m_interpolationAlpha);
+        hasInterpolated |= isBatchInterpolated;
+
+        if constexpr (T::LAYOUT == InstanceLayout::MAT4) {
+          models.resize(current.size());
+          current.calcModelMatrices(models.data());
+          for (size_t i = 0; i < current.size(); ++i)
+            out[begin + i] = {models[i], colors[i]};
+        } else {
+          for (size_t i = 0; i < current.size(); ++i) {
+            glm::vec3 position = current.getPosition(i);
+            glm::vec3 scale    = current.getScale(i);
+
+            if constexpr (T::LAYOUT == InstanceLayout::COMPACT_2D) {
+              glm::quat rotation = current.getRotation(i);
+
+              float angle = rotation.z != 0.f ? 2.f * std::atan2(rotation.z, rotation.w) : 0.f;
+              out[begin + i] = {glm::vec2(position), glm::vec2(scale), angle, colors[i]};
+            } else {
+              out[begin + i] = {glm::vec2(position), glm::packHalf2x16(glm::vec2(scale)),
+                                colors[i]};
+            }
+          }
+        }
+      }
+      return hasInterpolated;
+    }
+
   private:
+    using HistoryView = decltype(std::declval<entt::registry &>().view<TransformHistory>());
+
+    constexpr static size_t INSTANCE_BATCH_SIZE = 256;
+
     RenderSettings m_renderSettings;
+    HistoryView m_historyView;
+    float m_interpolationAlpha = 1.f;
   };
 } // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -1,11 +1,18 @@
 #pragma once
 
 #include <TritiumEngine/Rendering/Components/Camera.hpp>
+#include <TritiumEngine/Rendering/Components/InstancedRenderable.hpp>
 #include <TritiumEngine/Rendering/Components/Renderable.hpp>
 #include <TritiumEngine/Rendering/Components/Shader.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
 #include <TritiumEngine/Rendering/Systems/RenderSystem.hpp>
 #include <TritiumEngine/Utilities/ColorUtils.hpp>
 
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+
 using namespace TritiumEngine::Core;
 
 namespace TritiumEngine::Rendering
@@ -13,22 +20,85 @@ namespace TritiumEngine::Rendering
   template <uint32_t CameraTag> class StandardRenderSystem : public RenderSystem<CameraTag> {
   public:
     StandardRenderSystem(RenderSettings renderSettings = {})
-        : RenderSystem<CameraTag>(renderSettings) {}
+        : RenderSystem<CameraTag>(renderSettings) {
+      RenderSystem<CameraTag>::template reads<Renderable, Transform, Shader, Color>();
+    }
+
+    /**
+     * @brief Enables automatic instancing for renderables using the given shader. Each frame,
+     * consecutive renderables in view order sharing a mesh, shader and render mode are gathered
+     * into a transient instance buffer and drawn with a single instanced call using the instanced
+     * shader. A batch is drawn before any other renderable following it, so the draw order, and
+     * with it blending, stays the same as without instancing.
+     * @param shader The shader used by the renderables to batch
+     * @param instancedShader Instanced counterpart of the shader, reading model matrices and colors
+     * from per-instance attributes
+     */
+    void enableAutoInstancing(ShaderId shader, ShaderId instancedShader) {
+      m_instancedShaders[shader] = instancedShader;
+    }
+
+    /**
+     * @brief Disables automatic instancing for renderables using the given shader
+     * @param shader The shader to stop batching
+     */
+    void disableAutoInstancing(ShaderId shader) {
+      m_instancedShaders.erase(shader);
+      std::erase_if(m_batches,
+                    [&](const auto &batch) { return std::get<1>(batch.first) == shader; });
+    }
+
+    bool isAutoInstancing() const { return !m_instancedShaders.empty(); }
 
     void draw(const Camera &camera) const override {
       auto &shaderManager = RenderSystem<CameraTag>::m_app->shaderManager;
       auto &registry      = RenderSystem<CameraTag>::m_app->registry;
 
+      for (auto &[key, batch] : m_batches) {
+        batch.count      = 0;
+        batch.drawnCount = 0;
+      }
+
+      // Uniform handles are resolved once per shader change rather than per draw
+      ShaderId resolvedShader = 0;
+      Uniform<glm::mat4> modelUniform;
+      Uniform<glm::vec4> colorUniform;
+
+      // Batch still gathering renderables, drawn once anything else is drawn after it
+      BatchKey pendingKey = {};
+      Batch *pendingBatch = nullptr;
+
       registry.view<Renderable, Transform, Shader, Color>().each(
           [&](auto entity, Renderable &renderable, Transform &transform, Shader &shader,
               Color &color) {
+            glm::mat4 model = RenderSystem<CameraTag>::getModelMatrix(entity, transform);
+
+            // Gather renderables that can be batched into their instance buffer
+            if (m_instancedShaders.contains(shader.id)) {
+              BatchKey key = {renderable.getMesh().get(), shader.id, renderable.getRenderMode()};
+              if (pendingBatch && key != pendingKey)
+                drawBatch(pendingKey, *pendingBatch);
+
+              pendingKey   = key;
+              pendingBatch = &addToBatch(renderable, key, {model, color.value});
+              return;
+            }
+
+            if (pendingBatch) {
+              drawBatch(pendingKey, *pendingBatch);
+              pendingBatch = nullptr;
+            }
+
             // Apply properties to shader
-            if (shader.id != shaderManager.getCurrentShader()) {
+            if (shader.id != shaderManager.getCurrentShader())
               shaderManager.use(shader.id);
-              shaderManager.setMatrix4("projectionView", camera.calcProjectionViewMatrix());
+            if (shader.id != resolvedShader) {
+              modelUniform   = shaderManager.getUniform<glm::mat4>(shader.id, "model");
+              colorUniform   = shaderManager.getUniform<glm::vec4>(shader.id, "color");
+              resolvedShader = shader.id;
             }
-            shaderManager.setMatrix4("model", transform.getModelMatrix());
-            shaderManager.setVector4("color", ColorUtils::ToNormalizedVec4(color));
+            shaderManager.setMatrix4(modelUniform, model);
+            shaderManager.setVector4(colorUniform, ColorUtils::ToNormalizedVec4(color));
 
             unsigned int vao        = renderable.getVao();
             int vertexStride        = renderable.getVertexStride();
@@ -37,13 +107,85 @@ namespace TritiumEngine::Rendering
             unsigned int renderMode = renderable.getRenderMode();
 
             // Draw the renderable
-            glBindVertexArray(vao);
+            GLState::bindVertexArray(vao);
             if (nIndices > 0)
               glDrawElements(renderMode, nIndices, GL_UNSIGNED_INT, 0);
             else
               glDrawArrays(renderMode, 0, nVertices / vertexStride);
           });
+
+      if (pendingBatch)
+        drawBatch(pendingKey, *pendingBatch);
+
+      // Batches left empty this frame no longer have any renderables, release their buffers
+      std::erase_if(m_batches, [](const auto &batch) { return batch.second.count == 0; });
       shaderManager.use(0);
     }
+
+  private:
+    using BatchKey = std::tuple<const Mesh *, ShaderId, unsigned int>;
+
+    struct Batch {
+      std::unique_ptr<InstancedRenderable> renderable;
+      size_t count      = 0; // Instances gathered this frame
+      size_t drawnCount = 0; // Instances already drawn this frame
+    };
+
+    Batch &addToBatch(const Renderable &renderable, const BatchKey &key,
+                      const InstanceData &data) const {
+      const auto &mesh = renderable.getMesh();
+      auto &batch      = m_batches[key];
+
+      if (!batch.renderable) {
+        batch.renderable = std::make_unique<InstancedRenderable>(renderable.getRenderMode(), mesh,
+                                                                 INITIAL_BATCH_SIZE);
+      } else if (batch.count >= static_cast<size_t>(batch.renderable->getNumInstances())) {
+        batch.renderable->resizeInstanceDataBuffer(2 * batch.count);
+      }
+
+      // First renderable of this batch in the current frame
+      if (batch.count == 0)
+        batch.renderable->beginInstanceDataUpdate();
+
+      batch.renderable->setInstanceData(batch.count++, data);
+      return batch;
+    }
+
+    /** @brief Draws the instances gathered into a batch since it was last drawn this frame */
+    void drawBatch(const BatchKey &key, Batch &batch) const {
+      auto &shaderManager = RenderSystem<CameraTag>::m_app->shaderManager;
+
+      ShaderId instancedShader = m_instancedShaders.at(std::get<1>(key));
+      if (instancedShader != shaderManager.getCurrentShader())
+        shaderManager.use(instancedShader);
+
+      // Earlier runs of this batch were already drawn from the start of the buffer
+      auto &renderable = *batch.renderable;
+      size_t first     = batch.drawnCount;
+      renderable.updateInstanceDataBuffer(first, batch.count - first);
+
+      unsigned int vao        = renderable.getVao();
+      int vertexStride        = renderable.getVertexStride();
+      int nVertices           = renderable.getNumVertices();
+      int nIndices            = renderable.getNumIndices();
+      unsigned int renderMode = renderable.getRenderMode();
+      int nInstances          = static_cast<int>(batch.count - first);
+      auto baseInstance       = static_cast<unsigned int>(first);
+
+      // Draw the run of renderables gathered since, reading instances from where it starts
+      GLState::bindVertexArray(vao);
+      if (nIndices > 0)
+        glDrawElementsInstancedBaseInstance(renderMode, nIndices, GL_UNSIGNED_INT, 0, nInstances,
+                                            baseInstance);
+      else
+        glDrawArraysInstancedBaseInstance(renderMode, 0, nVertices / vertexStride, nInstances,
+                                          baseInstance);
+      batch.drawnCount = batch.count;
+    }
+
+    constexpr static int INITIAL_BATCH_SIZE = 64;
+
+    std::unordered_map<ShaderId, ShaderId> m_instancedShaders;
+    mutable std::map<BatchKey, Batch> m_batches;
   };
 } // namespace TritiumEngine::Rendering
\ No newline at end of file
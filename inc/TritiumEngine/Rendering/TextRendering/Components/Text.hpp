@@ -1,7 +1,11 @@
 #pragma once
 
+#include <glm/glm.hpp>
+
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace TritiumEngine::Rendering
 {
@@ -21,24 +25,49 @@ namespace TritiumEngine::Rendering
       BOTTOM_RIGHT
     };
 
+    struct Glyph {
+      glm::vec2 position; // Bottom left corner of the glyph quad in text space
+      glm::vec2 size;     // Size of the glyph quad in text space
+      glm::vec2 uvMin;    // Top left texture coordinates of glyph in the font atlas
+      glm::vec2 uvMax;    // Bottom right texture coordinates of glyph in the font atlas
+    };
+
+    struct Layout {
+      std::vector<Glyph> glyphs;
+      float pixelWidth;
+      float pixelHeight;
+      uint64_t version; // Unique for every layout built, changes whenever the layout is rebuilt
+    };
+
     Text(const std::string &text, const std::string &font, float scaleFactor = 1.f,
          Alignment alignment = Alignment::BOTTOM_LEFT);
-    virtual ~Text();
+    virtual ~Text() = default;
 
     float getPixelWidth() const;
     float getPixelHeight() const;
     float getMaxFontPixelHeight() const;
+    const Layout &getLayout() const;
     Font *getFont() const { return m_font.get(); }
-    unsigned int getVao() const { return m_vao; }
-    unsigned int getVbo() const { return m_vbo; }
+    void setFont(const std::string &font);
 
     std::string text;
     float scaleFactor;
     Alignment align;
 
   private:
+    bool isLayoutValid() const;
+    void buildLayout() const;
+    glm::vec2 getStartPosition(float pixelWidth) const;
+
+    static inline uint64_t s_nextLayoutVersion = 1;
+
     std::shared_ptr<Font> m_font;
-    unsigned int m_vao;
-    unsigned int m_vbo;
+
+    // Layout cache along with the properties it was built from
+    mutable Layout m_layout;
+    mutable std::string m_layoutText;
+    mutable float m_layoutScaleFactor;
+    mutable Alignment m_layoutAlign;
+    mutable const Font *m_layoutFont;
   };
 } // namespace TritiumEngine::Rendering
\ No newline at end of file
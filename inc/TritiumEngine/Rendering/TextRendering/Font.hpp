@@ -8,13 +8,16 @@ namespace TritiumEngine::Rendering
     constexpr static size_t CHAR_ARRAY_SIZE = 128;
 
     struct Character {
-      unsigned int textureID; // ID handle of the glyph texture
-      glm::ivec2 size;        // Size of glyph
-      glm::ivec2 bearing;     // Offset from baseline to left/top of glyph
-      signed long advance;    // Offset to advance to next glyph
+      glm::vec2 uvMin;     // Top left texture coordinates of glyph in the atlas
+      glm::vec2 uvMax;     // Bottom right texture coordinates of glyph in the atlas
+      glm::ivec2 size;     // Size of glyph
+      glm::ivec2 bearing;  // Offset from baseline to left/top of glyph
+      signed long advance; // Offset to advance to next glyph
     };
 
     Character characters[CHAR_ARRAY_SIZE];
     unsigned int maxHeight;
+    unsigned int atlasTextureID; // ID handle of the texture all glyphs are packed into
+    glm::ivec2 atlasSize;
   };
 } // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -16,6 +16,9 @@ namespace TritiumEngine::Rendering
     Font *load(const std::string &filePath) override;
 
   private:
+    constexpr static int ATLAS_WIDTH   = 1024; // Width of the glyph atlas texture in pixels
+    constexpr static int ATLAS_PADDING = 1;    // Empty pixels around each glyph in the atlas
+
     bool loadFont(Font *font, const std::string &filePath, FT_Library &ft) const;
     void logFTErrorMessage(const FT_Error &error) const;
 
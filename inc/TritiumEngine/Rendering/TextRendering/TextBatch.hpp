@@ -0,0 +1,71 @@
+#pragma once
+
+#include <TritiumEngine/Rendering/TextRendering/Components/Text.hpp>
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace TritiumEngine::Rendering
+{
+  struct Font;
+  class ShaderManager;
+
+  /**
+   * @brief Collects the glyph quads of many texts into a single streaming vertex buffer, so that
+   * all texts sharing a font and shader are drawn with one draw call. The buffer is kept on the GPU
+   * and only rebuilt once a text layout, transform, shader or color differs from the last flush.
+   */
+  class TextBatch {
+  public:
+    TextBatch();
+    TextBatch(const TextBatch &)            = delete;
+    TextBatch &operator=(const TextBatch &) = delete;
+    ~TextBatch();
+
+    void add(const Text &text, unsigned int shader, const glm::mat4 &transform, uint32_t color);
+    void flush(ShaderManager &shaderManager);
+
+  private:
+    struct Vertex {
+      glm::vec4 position; // Clip space position
+      glm::vec2 texCoords;
+      uint32_t color;
+    };
+
+    struct Entry {
+      const Text *text;
+      uint64_t layoutVersion;
+      unsigned int shader;
+      const Font *font;
+      glm::mat4 transform;
+      uint32_t color;
+    };
+
+    struct Draw {
+      unsigned int shader;
+      const Font *font;
+      int nVertices;
+      int baseVertex;
+    };
+
+    constexpr static size_t INITIAL_CAPACITY = 1024; // Glyphs the buffers initially hold
+
+    static bool isSameEntry(const Entry &a, const Entry &b);
+
+    void rebuild();
+    void reserve(size_t nGlyphs);
+
+    std::vector<Entry> m_entries;     // Texts added since the last flush
+    std::vector<Entry> m_lastEntries; // Texts the buffer was last built from
+    std::vector<Draw> m_draws;
+    std::map<std::pair<unsigned int, const Font *>, std::vector<Vertex>> m_groups;
+    unsigned int m_vao;
+    unsigned int m_vbo;
+    unsigned int m_ebo;
+    size_t m_capacity;
+  };
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
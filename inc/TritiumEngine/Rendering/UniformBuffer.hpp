@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+namespace TritiumEngine::Rendering
+{
+  class UniformBuffer {
+  public:
+    UniformBuffer(size_t size);
+    UniformBuffer(const UniformBuffer &)            = delete;
+    UniformBuffer &operator=(const UniformBuffer &) = delete;
+    ~UniformBuffer();
+
+    void setData(const void *data, size_t size, size_t offset = 0) const;
+    void bind(unsigned int binding) const;
+    unsigned int getId() const { return m_id; }
+    size_t getSize() const { return m_size; }
+
+  private:
+    unsigned int m_id;
+    size_t m_size;
+  };
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -29,6 +29,8 @@ namespace TritiumEngine::Utilities
 
     entt::entity m_fpsText       = entt::null;
     entt::entity m_frameTimeText = entt::null;
+    entt::entity m_glStateText   = entt::null;
+    entt::entity m_lodText       = entt::null;
 
     inline static int m_nFrames = 0;
     inline static float m_sumDt = 0.f;
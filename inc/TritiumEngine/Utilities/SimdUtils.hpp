@@ -0,0 +1,26 @@
+#pragma once
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define TRITIUM_SIMD_X86
+#endif
+
+// Allows functions to use instructions beyond the compiler's baseline, MSVC allows this by default
+#if defined(TRITIUM_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define TRITIUM_TARGET_SSE4 __attribute__((target("sse4.1")))
+#define TRITIUM_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define TRITIUM_TARGET_SSE4
+#define TRITIUM_TARGET_AVX2
+#endif
+
+namespace TritiumEngine::Utilities
+{
+  class SimdUtils {
+  public:
+    /** @brief Instruction sets kernels can be dispatched to, from narrowest to widest */
+    enum class Level { SCALAR, SSE4, AVX2 };
+
+    static Level GetSupportedLevel();
+    static const char *GetLevelName(Level level);
+  };
+} // namespace TritiumEngine::Utilities
\ No newline at end of file
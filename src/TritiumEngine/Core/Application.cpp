@@ -1,7 +1,13 @@
 #include <TritiumEngine/Core/Application.hpp>
 #include <TritiumEngine/Core/Scene.hpp>
+#include <TritiumEngine/Rendering/Components/Camera.hpp>
+#include <TritiumEngine/Rendering/Components/InstancedRenderable.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
 #include <TritiumEngine/Rendering/Window.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace TritiumEngine::Utilities;
 
 namespace TritiumEngine::Core
@@ -10,6 +16,8 @@ namespace TritiumEngine::Core
       : name(name), window(shaderManager, settings), inputManager(window.getHandle()),
         sceneManager(*this) {
     initGLEW();
+    InstancedRenderable::connectInstanceTags(registry);
+    shaderManager.setUniformBlockBinding("CameraData", Camera::UNIFORM_BINDING);
   }
 
   /** @brief Starts running the application */
@@ -38,9 +46,12 @@ namespace TritiumEngine::Core
       float deltaTime = std::chrono::duration<float>(m_currentTime - m_prevFrameTime).count();
       m_prevFrameTime = m_currentTime;
 
-      // Update scene
-      window.beginDraw();
+      // Update input, then advance the simulation in fixed steps before rendering the scene
+      GLState::newFrame();
       inputManager.update(deltaTime);
+      simulate(deltaTime);
+
+      window.beginDraw();
       sceneManager.update(deltaTime);
       window.endDraw();
 
@@ -60,6 +71,46 @@ namespace TritiumEngine::Core
   /** @brief Check if the application is currently running */
   bool Application::isRunning() const { return m_isRunning; }
 
+  /**
+   * @brief Sets how many fixed steps per second simulation systems are updated at
+   * @param stepsPerSecond Simulation rate, independent of the frame rate
+   */
+  void Application::setSimulationRate(float stepsPerSecond) {
+    if (stepsPerSecond <= 0.f) {
+      Logger::warn("[Application] Simulation rate must be positive, got {}.", stepsPerSecond);
+      return;
+    }
+
+    m_simulationTimeStep = 1.f / stepsPerSecond;
+  }
+
+  /**
+   * @brief Sets how many simulation steps may run in a single frame to catch up with real time.
+   * Any time left over past this limit is dropped, so a slow frame slows the simulation down
+   * rather than causing ever more steps in the frames after.
+   * @param maxSteps Maximum number of simulation steps per frame
+   */
+  void Application::setMaxSimulationSteps(int maxSteps) {
+    m_maxSimulationSteps = std::max(maxSteps, 1);
+  }
+
+  void Application::simulate(float deltaTime) {
+    m_simulationTime += deltaTime;
+
+    int nSteps = 0;
+    while (m_simulationTime >= m_simulationTimeStep && nSteps < m_maxSimulationSteps) {
+      sceneManager.fixedUpdate(m_simulationTimeStep);
+      m_simulationTime -= m_simulationTimeStep;
+      ++nSteps;
+    }
+
+    if (m_simulationTime >= m_simulationTimeStep)
+      m_simulationTime = std::fmod(m_simulationTime, m_simulationTimeStep);
+
+    // Rendering interpolates between the last two simulation states by the time left over
+    m_interpolationAlpha = m_simulationTime / m_simulationTimeStep;
+  }
+
   void Application::initGLEW() const {
     // Initialise GLEW library
     glewExperimental = GL_TRUE;
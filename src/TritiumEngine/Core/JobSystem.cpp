@@ -0,0 +1,159 @@
+#include <TritiumEngine/Core/JobSystem.hpp>
+#include <TritiumEngine/Utilities/Logger.hpp>
+
+#include <algorithm>
+
+using namespace TritiumEngine::Utilities;
+
+namespace TritiumEngine::Core
+{
+  JobSystem::JobSystem(unsigned int nWorkers) : m_nQueuedJobs(0), m_isRunning(true) {
+    // hardware_concurrency() may report 0, in which case everything runs on the calling thread
+    if (nWorkers > std::thread::hardware_concurrency())
+      nWorkers = 0;
+
+    for (unsigned int i = 0; i <= nWorkers; ++i)
+      m_queues.push_back(std::make_unique<JobQueue>());
+
+    for (unsigned int i = 1; i <= nWorkers; ++i)
+      m_workers.emplace_back(&JobSystem::workerLoop, this, i);
+
+    Logger::info("[JobSystem] Started {} worker threads.", nWorkers);
+  }
+
+  JobSystem::~JobSystem() {
+    {
+      std::lock_guard lock(m_wakeMutex);
+      m_isRunning = false;
+    }
+    m_wakeCondition.notify_all();
+
+    for (auto &worker : m_workers)
+      worker.join();
+  }
+
+  /**
+   * @brief Queues a job to be run by any thread
+   * @param job The job to run
+   * @param counter Counter incremented until the job has finished
+   */
+  void JobSystem::schedule(Job job, JobCounter &counter) {
+    ++counter.pending;
+
+    auto &queue = *m_queues[s_queueIndex];
+    {
+      std::lock_guard lock(queue.mutex);
+      queue.jobs.push_back({std::move(job), &counter});
+    }
+
+    {
+      std::lock_guard lock(m_wakeMutex);
+      ++m_nQueuedJobs;
+    }
+    m_wakeCondition.notify_one();
+  }
+
+  /**
+   * @brief Waits until all jobs scheduled against the counter have finished, running queued jobs
+   * in the meantime
+   */
+  void JobSystem::wait(const JobCounter &counter) {
+    while (counter.pending > 0) {
+      if (!tryRunJob(s_queueIndex))
+        std::this_thread::yield();
+    }
+  }
+
+  /**
+   * @brief Runs a single queued job on the calling thread, if there is one
+   * @return True if a job was run, false otherwise
+   */
+  bool JobSystem::runPendingJob() { return tryRunJob(s_queueIndex); }
+
+  /**
+   * @brief Splits a range into chunks and runs them across all threads, returning once every chunk
+   * has finished
+   * @param count Number of items in the range
+   * @param job Function called with the begin and end index of each chunk
+   * @param chunkSize Number of items per chunk, chosen automatically if 0
+   */
+  void JobSystem::parallelFor(size_t count, const RangeJob &job, size_t chunkSize) {
+    if (chunkSize == 0)
+      chunkSize = getChunkSize(count);
+
+    // Not worth the scheduling overhead for a single chunk
+    if (count <= chunkSize) {
+      if (count > 0)
+        job(0, count);
+      return;
+    }
+
+    JobCounter counter;
+    for (size_t begin = 0; begin < count; begin += chunkSize) {
+      size_t end = std::min(begin + chunkSize, count);
+      schedule([&job, begin, end]() { job(begin, end); }, counter);
+    }
+    wait(counter);
+  }
+
+  /**
+   * @brief Obtains the chunk size used to split a range of the given size when none is specified.
+   * Ranges are split into a few chunks per thread so that faster threads can steal the remainder,
+   * without chunks getting too small to be worth scheduling.
+   */
+  size_t JobSystem::getChunkSize(size_t count) const {
+    size_t nChunks = (m_workers.size() + 1) * CHUNKS_PER_THREAD;
+    return std::max(MIN_CHUNK_SIZE, (count + nChunks - 1) / nChunks);
+  }
+
+  void JobSystem::workerLoop(unsigned int queueIndex) {
+    s_queueIndex = queueIndex;
+
+    while (m_isRunning) {
+      if (tryRunJob(queueIndex))
+        continue;
+
+      std::unique_lock lock(m_wakeMutex);
+      m_wakeCondition.wait(lock, [this]() { return m_nQueuedJobs > 0 || !m_isRunning; });
+    }
+  }
+
+  bool JobSystem::tryRunJob(unsigned int queueIndex) {
+    QueuedJob job;
+    if (!popJob(queueIndex, job) && !stealJob(queueIndex, job))
+      return false;
+
+    --m_nQueuedJobs;
+    job.job();
+    --job.counter->pending;
+    return true;
+  }
+
+  // Takes the most recently queued job from the thread's own queue
+  bool JobSystem::popJob(unsigned int queueIndex, QueuedJob &job) {
+    auto &queue = *m_queues[queueIndex];
+    std::lock_guard lock(queue.mutex);
+    if (queue.jobs.empty())
+      return false;
+
+    job = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    return true;
+  }
+
+  // Takes the oldest queued job from any other thread's queue
+  bool JobSystem::stealJob(unsigned int queueIndex, QueuedJob &job) {
+    size_t nQueues = m_queues.size();
+    for (size_t offset = 1; offset < nQueues; ++offset) {
+      auto &queue = *m_queues[(queueIndex + offset) % nQueues];
+      std::lock_guard lock(queue.mutex);
+      if (queue.jobs.empty())
+        continue;
+
+      job = std::move(queue.jobs.front());
+      queue.jobs.pop_front();
+      return true;
+    }
+    return false;
+  }
+} // namespace TritiumEngine::Core
\ No newline at end of file
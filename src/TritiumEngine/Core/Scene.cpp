@@ -1,8 +1,12 @@
 #include <TritiumEngine/Core/Application.hpp>
 #include <TritiumEngine/Core/Components/NativeScript.hpp>
+#include <TritiumEngine/Core/Components/Transform.hpp>
+#include <TritiumEngine/Core/Components/TransformHistory.hpp>
 #include <TritiumEngine/Core/Scene.hpp>
 #include <TritiumEngine/Core/Scriptable.hpp>
 #include <TritiumEngine/Core/System.hpp>
+#include <TritiumEngine/Core/TransformBatch.hpp>
+#include <TritiumEngine/Rendering/Components/InstancedRenderable.hpp>
 #include <TritiumEngine/Rendering/Window.hpp>
 
 #include <entt/entt.hpp>
@@ -29,19 +33,41 @@ namespace TritiumEngine::Core
         [&](auto entity, NativeScript &script) { script.getInstance().dispose(); });
     dispose();
 
-    m_systems.clear();
+    clearSystems();
     m_app.registry.clear();
     m_app.dispatcher.clear();
     Logger::info("[Scene] Scene '{}' unloaded.", name);
   }
 
   /**
-   * @brief Updates all active systems and scripts
+   * @brief Advances the simulation by a single fixed step. Transform histories are recorded first,
+   * then all simulation systems are updated. Systems that do not conflict with each other run
+   * concurrently.
+   * @param dt Fixed simulation time step
+   */
+  void Scene::fixedUpdate(float dt) {
+    if (m_isScheduleDirty)
+      buildSchedules();
+
+    auto view = m_app.registry.view<Transform, TransformHistory>();
+    m_app.jobSystem.parallelEach(
+        view, [](auto entity, Transform &transform, TransformHistory &history) {
+          history.record(transform);
+        });
+
+    runSystems(System::UpdatePhase::SIMULATION, dt);
+  }
+
+  /**
+   * @brief Updates all frame systems, such as rendering, and active scripts
    * @param dt Time delta since last frame
    */
   void Scene::update(float dt) {
-    for (auto &system : m_systems)
-      system->update(dt);
+    if (m_isScheduleDirty)
+      buildSchedules();
+
+    flushTransforms();
+    runSystems(System::UpdatePhase::FRAME, dt);
 
     m_app.registry.view<NativeScript>().each([&](auto entity, NativeScript &script) {
       if (script.getInstance().isEnabled())
@@ -49,4 +75,103 @@ namespace TritiumEngine::Core
     });
     onUpdate(dt);
   }
+
+  /**
+   * @brief Runs all registered systems of the given update phase through their schedule
+   * @param phase The update phase to run
+   * @param dt Time step for the phase
+   */
+  void Scene::runSystems(System::UpdatePhase phase, float dt) {
+    if (phase == System::UpdatePhase::SIMULATION)
+      m_simulationScheduler.run(m_app.jobSystem, dt);
+    else
+      m_frameScheduler.run(m_app.jobSystem, dt);
+  }
+
+  /** @brief Destroys all registered systems, invalidating any handles to them */
+  void Scene::clearSystems() {
+    m_slots.clear();
+    m_freeSlots.clear();
+    m_systemOrder.clear();
+    m_slotIndices.clear();
+    m_isScheduleDirty = true;
+  }
+
+  /**
+   * @brief Recalculates the cached model matrices of all transforms changed since the last frame,
+   * so that render systems only read cached matrices. Dirty transforms are packed into a
+   * TransformBatch per chunk to calculate their matrices with SIMD, while transforms that did not
+   * change cost no matrix math. Instance set members and entities rendered in between two
+   * simulation states never read their cached matrix, as render systems compute their instance
+   * data in their own batches, so they are skipped.
+   */
+  void Scene::flushTransforms() {
+    auto view        = m_app.registry.view<Transform>(entt::exclude<Rendering::InstanceTag>);
+    auto historyView = m_app.registry.view<TransformHistory>();
+    m_transformEntities.assign(view.begin(), view.end());
+
+    m_app.jobSystem.parallelFor(m_transformEntities.size(), [&](size_t begin, size_t end) {
+      thread_local TransformBatch batch;
+      thread_local std::vector<Transform *> dirty;
+      thread_local std::vector<glm::mat4> models;
+
+      batch.clear();
+      dirty.clear();
+      for (size_t i = begin; i < end; ++i) {
+        auto entity     = m_transformEntities[i];
+        auto &transform = view.get<Transform>(entity);
+        if (!transform.isDirty())
+          continue;
+
+        if (historyView.contains(entity) &&
+            !historyView.get<TransformHistory>(entity).isUnchanged(transform))
+          continue;
+
+        batch.push(transform);
+        dirty.push_back(&transform);
+      }
+
+      models.resize(dirty.size());
+      batch.calcModelMatrices(models.data());
+      TransformBatch::storeModelMatrices(models.data(), dirty.data(), dirty.size());
+    });
+  }
+
+  /** @brief Logs the system schedules along with the duration of each system's last update */
+  void Scene::logSchedule() const {
+    Logger::info("[Scene] Scene '{}' simulation:\n{}", name,
+                 m_simulationScheduler.getScheduleDump());
+    Logger::info("[Scene] Scene '{}' frame:\n{}", name, m_frameScheduler.getScheduleDump());
+  }
+
+  /**
+   * @brief Destroys the system in the given slot and frees the slot for reuse. Handles to the
+   * system are invalidated since a freed slot never matches a handle's generation.
+   */
+  void Scene::releaseSlot(uint32_t index) {
+    SystemSlot &slot = m_slots[index];
+    slot.system.reset();
+    slot.type       = 0;
+    slot.generation = 0;
+
+    std::erase(m_systemOrder, index);
+    m_freeSlots.push_back(index);
+    m_isScheduleDirty = true;
+  }
+
+  void Scene::buildSchedules() {
+    std::vector<System *> simulationSystems;
+    std::vector<System *> frameSystems;
+    for (uint32_t index : m_systemOrder) {
+      System *system = m_slots[index].system.get();
+      if (system->getUpdatePhase() == System::UpdatePhase::SIMULATION)
+        simulationSystems.push_back(system);
+      else
+        frameSystems.push_back(system);
+    }
+
+    m_simulationScheduler.build(simulationSystems);
+    m_frameScheduler.build(frameSystems);
+    m_isScheduleDirty = false;
+  }
 } // namespace TritiumEngine::Core
\ No newline at end of file
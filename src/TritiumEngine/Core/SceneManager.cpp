@@ -67,12 +67,20 @@ namespace TritiumEngine::Core
   /** @brief Reloads the current scene */
   void SceneManager::reloadCurrentScene() { loadScene(m_sceneIt); }
 
+  /** @brief Advances the simulation of the current scene by a fixed step */
+  void SceneManager::fixedUpdate(float dt) const { (*m_sceneIt)->fixedUpdate(dt); }
+
   /** @brief Updates the current scene */
   void SceneManager::update(float dt) const { (*m_sceneIt)->update(dt); }
 
   /** @brief Determines if the manager has any registered scenes */
   bool SceneManager::hasScenes() const { return !m_scenes.empty(); }
 
+  /** @brief Obtains the currently loaded scene, or nullptr if no scene has been loaded */
+  Scene *SceneManager::getCurrentScene() const {
+    return m_sceneIt != m_scenes.end() ? m_sceneIt->get() : nullptr;
+  }
+
   void SceneManager::loadScene(SceneList::iterator it) {
     // Unloads current scene iterator and loads new one
     if (m_sceneIt != m_scenes.end())
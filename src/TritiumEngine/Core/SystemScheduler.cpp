@@ -0,0 +1,208 @@
+#include <TritiumEngine/Core/System.hpp>
+#include <TritiumEngine/Core/SystemScheduler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <memory>
+#include <thread>
+#include <typeinfo>
+
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define TRITIUM_HAS_CXXABI
+#endif
+
+namespace
+{
+  // Obtains a readable name of a type, GCC and Clang only provide mangled names through typeid
+  std::string getTypeName(const std::type_info &type) {
+#ifdef TRITIUM_HAS_CXXABI
+    int status = 0;
+    std::unique_ptr<char, void (*)(void *)> demangled(
+        abi::__cxa_demangle(type.name(), nullptr, nullptr, &status), std::free);
+    if (status == 0 && demangled)
+      return demangled.get();
+#endif
+    return type.name();
+  }
+} // namespace
+
+namespace TritiumEngine::Core
+{
+  /**
+   * @brief Builds the dependency graph of the given systems. Only needs calling again once systems
+   * have been added or removed.
+   * @param systems Systems in the order they were registered
+   */
+  void SystemScheduler::build(const std::vector<System *> &systems) {
+    m_nodes.clear();
+    for (System *system : systems)
+      m_nodes.push_back({system, {}, {}, 0.f});
+
+    // Edges only ever point to later systems, so registration order is a valid topological order
+    for (size_t j = 0; j < m_nodes.size(); ++j) {
+      for (size_t i = 0; i < j; ++i) {
+        if (!isConflicting(*m_nodes[i].system, *m_nodes[j].system))
+          continue;
+
+        m_nodes[i].successors.push_back(j);
+        m_nodes[j].predecessors.push_back(i);
+      }
+    }
+
+    m_remainingDependencies = std::make_unique<std::atomic<size_t>[]>(m_nodes.size());
+  }
+
+  /**
+   * @brief Runs all systems once, returning when every system has finished. Must be called from
+   * the main thread.
+   * @param jobSystem Job system used to run systems that are not main thread only
+   * @param dt Time delta passed to each system
+   */
+  void SystemScheduler::run(JobSystem &jobSystem, float dt) {
+    m_jobSystem = &jobSystem;
+    m_dt        = dt;
+    m_nFinished = 0;
+    m_readyMainThread.clear();
+
+    for (size_t i = 0; i < m_nodes.size(); ++i)
+      m_remainingDependencies[i] = m_nodes[i].predecessors.size();
+
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+      if (m_nodes[i].predecessors.empty())
+        launch(i);
+    }
+
+    // Run main thread systems as they become ready, helping with other jobs in the meantime
+    while (m_nFinished < m_nodes.size()) {
+      size_t index = m_nodes.size();
+      {
+        std::lock_guard lock(m_readyMutex);
+        if (!m_readyMainThread.empty()) {
+          // Take the earliest registered system to keep main thread systems in order
+          auto it = std::min_element(m_readyMainThread.begin(), m_readyMainThread.end());
+          index   = *it;
+          m_readyMainThread.erase(it);
+        }
+      }
+
+      if (index < m_nodes.size())
+        execute(index);
+      else if (!jobSystem.runPendingJob())
+        std::this_thread::yield();
+    }
+
+    jobSystem.wait(m_counter);
+  }
+
+  /**
+   * @brief Obtains a readable description of the schedule, listing each system with its thread,
+   * dependencies and last update duration, followed by the critical path through the graph
+   */
+  std::string SystemScheduler::getScheduleDump() const {
+    auto getName = [](const System *system) { return getTypeName(typeid(*system)); };
+
+    std::string dump = "System schedule:\n";
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+      const auto &node = m_nodes[i];
+      std::string dependencies;
+      for (size_t predecessor : node.predecessors)
+        dependencies += std::format(" {}", predecessor);
+
+      dump += std::format("  [{}] {} ({}, {:.3f}ms) after:{}\n", i, getName(node.system),
+                          node.system->isMainThreadOnly() ? "main" : "worker", node.lastMs,
+                          dependencies.empty() ? " none" : dependencies);
+    }
+
+    float totalMs = 0.f;
+    dump += "Critical path:\n";
+    for (size_t index : getCriticalPath(totalMs))
+      dump += std::format("  [{}] {} ({:.3f}ms)\n", index, getName(m_nodes[index].system),
+                          m_nodes[index].lastMs);
+    dump += std::format("  Total: {:.3f}ms", totalMs);
+
+    return dump;
+  }
+
+  bool SystemScheduler::isConflicting(const System &a, const System &b) {
+    // Main thread systems keep their relative order, e.g. render systems drawing on top of others
+    if (a.isMainThreadOnly() && b.isMainThreadOnly())
+      return true;
+
+    if (!a.hasDeclaredAccess() || !b.hasDeclaredAccess())
+      return true;
+
+    auto isWrittenBy = [](const std::vector<ComponentAccess> &accesses, const System &system) {
+      return std::any_of(accesses.begin(), accesses.end(), [&](const ComponentAccess &access) {
+        return std::any_of(system.getWrites().begin(), system.getWrites().end(),
+                           [&](const ComponentAccess &write) { return write.id == access.id; });
+      });
+    };
+
+    return isWrittenBy(a.getReads(), b) || isWrittenBy(a.getWrites(), b) ||
+           isWrittenBy(b.getReads(), a);
+  }
+
+  // Starts a system whose dependencies have all finished
+  void SystemScheduler::launch(size_t index) {
+    if (m_nodes[index].system->isMainThreadOnly()) {
+      std::lock_guard lock(m_readyMutex);
+      m_readyMainThread.push_back(index);
+      return;
+    }
+
+    m_jobSystem->schedule([this, index]() { execute(index); }, m_counter);
+  }
+
+  // Updates a system, then launches any systems that were only waiting on it
+  void SystemScheduler::execute(size_t index) {
+    auto &node = m_nodes[index];
+    auto start = std::chrono::high_resolution_clock::now();
+    node.system->update(m_dt);
+    auto end    = std::chrono::high_resolution_clock::now();
+    node.lastMs = std::chrono::duration<float, std::milli>(end - start).count();
+
+    for (size_t successor : node.successors) {
+      if (--m_remainingDependencies[successor] == 0)
+        launch(successor);
+    }
+    ++m_nFinished;
+  }
+
+  // Longest chain of dependent systems by their last update durations
+  std::vector<size_t> SystemScheduler::getCriticalPath(float &totalMs) const {
+    totalMs = 0.f;
+    if (m_nodes.empty())
+      return {};
+
+    // Earliest each system could start given unlimited threads, and which system it waited on
+    size_t nNodes = m_nodes.size();
+    std::vector<float> startMs(nNodes, 0.f);
+    std::vector<size_t> previous(nNodes, nNodes);
+    for (size_t i = 0; i < nNodes; ++i) {
+      for (size_t predecessor : m_nodes[i].predecessors) {
+        float finishMs = startMs[predecessor] + m_nodes[predecessor].lastMs;
+        if (finishMs > startMs[i]) {
+          startMs[i]  = finishMs;
+          previous[i] = predecessor;
+        }
+      }
+    }
+
+    // Walk back from the system finishing last
+    size_t last = 0;
+    for (size_t i = 0; i < nNodes; ++i) {
+      if (startMs[i] + m_nodes[i].lastMs > startMs[last] + m_nodes[last].lastMs)
+        last = i;
+    }
+    totalMs = startMs[last] + m_nodes[last].lastMs;
+
+    std::vector<size_t> path;
+    for (size_t index = last; index < nNodes; index = previous[index])
+      path.push_back(index);
+    std::reverse(path.begin(), path.end());
+    return path;
+  }
+} // namespace TritiumEngine::Core
\ No newline at end of file
@@ -0,0 +1,438 @@
+#include <TritiumEngine/Core/TransformBatch.hpp>
+#include <TritiumEngine/Utilities/Logger.hpp>
+
+#ifdef TRITIUM_SIMD_X86
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+namespace TritiumEngine::Core
+{
+#ifdef TRITIUM_SIMD_X86
+  namespace
+  {
+    /**
+     * @brief Transposes one column of 4 matrices from one register per row component into one
+     * register per matrix, then stores it
+     */
+    TRITIUM_TARGET_SSE4 void storeColumn4(float *out, int column, __m128 x, __m128 y, __m128 z,
+                                          __m128 w) {
+      _MM_TRANSPOSE4_PS(x, y, z, w);
+      _mm_storeu_ps(out + column * 4, x);
+      _mm_storeu_ps(out + 16 + column * 4, y);
+      _mm_storeu_ps(out + 32 + column * 4, z);
+      _mm_storeu_ps(out + 48 + column * 4, w);
+    }
+
+    /** @brief Same as storeColumn4, for 8 matrices. Each 128 bit lane is transposed separately. */
+    TRITIUM_TARGET_AVX2 void storeColumn8(float *out, int column, __m256 x, __m256 y, __m256 z,
+                                          __m256 w) {
+      __m256 t0 = _mm256_unpacklo_ps(x, y);
+      __m256 t1 = _mm256_unpackhi_ps(x, y);
+      __m256 t2 = _mm256_unpacklo_ps(z, w);
+      __m256 t3 = _mm256_unpackhi_ps(z, w);
+      __m256 m0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)); // Matrices 0 and 4
+      __m256 m1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)); // Matrices 1 and 5
+      __m256 m2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)); // Matrices 2 and 6
+      __m256 m3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)); // Matrices 3 and 7
+
+      out += column * 4;
+      _mm_storeu_ps(out, _mm256_castps256_ps128(m0));
+      _mm_storeu_ps(out + 16, _mm256_castps256_ps128(m1));
+      _mm_storeu_ps(out + 32, _mm256_castps256_ps128(m2));
+      _mm_storeu_ps(out + 48, _mm256_castps256_ps128(m3));
+      _mm_storeu_ps(out + 64, _mm256_extractf128_ps(m0, 1));
+      _mm_storeu_ps(out + 80, _mm256_extractf128_ps(m1, 1));
+      _mm_storeu_ps(out + 96, _mm256_extractf128_ps(m2, 1));
+      _mm_storeu_ps(out + 112, _mm256_extractf128_ps(m3, 1));
+    }
+
+    /** @brief Linearly interpolates 4 values */
+    TRITIUM_TARGET_SSE4 __m128 lerp4(__m128 from, __m128 to, __m128 alpha) {
+      return _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(to, from), alpha));
+    }
+
+    /** @brief Linearly interpolates 4 values from their previous values, in place */
+    TRITIUM_TARGET_SSE4 void lerpStore4(float *values, const float *previous, __m128 alpha) {
+      _mm_storeu_ps(values, lerp4(_mm_loadu_ps(previous), _mm_loadu_ps(values), alpha));
+    }
+
+    /** @brief Same as lerp4, for 8 values */
+    TRITIUM_TARGET_AVX2 __m256 lerp8(__m256 from, __m256 to, __m256 alpha) {
+      return _mm256_fmadd_ps(_mm256_sub_ps(to, from), alpha, from);
+    }
+
+    /** @brief Same as lerpStore4, for 8 values */
+    TRITIUM_TARGET_AVX2 void lerpStore8(float *values, const float *previous, __m256 alpha) {
+      _mm256_storeu_ps(values, lerp8(_mm256_loadu_ps(previous), _mm256_loadu_ps(values), alpha));
+    }
+  } // namespace
+#endif
+
+  void TransformBatch::clear() {
+    for (auto *values : {&m_positionX, &m_positionY, &m_positionZ, &m_rotationX, &m_rotationY,
+                         &m_rotationZ, &m_rotationW, &m_scaleX, &m_scaleY, &m_scaleZ})
+      values->clear();
+  }
+
+  void TransformBatch::reserve(size_t count) {
+    for (auto *values : {&m_positionX, &m_positionY, &m_positionZ, &m_rotationX, &m_rotationY,
+                         &m_rotationZ, &m_rotationW, &m_scaleX, &m_scaleY, &m_scaleZ})
+      values->reserve(count);
+  }
+
+  /** @brief Appends a copy of the transform's position, rotation and scale to the batch */
+  void TransformBatch::push(const Transform &transform) {
+    const auto &position = transform.getPosition();
+    const auto &rotation = transform.getRotation();
+    const auto &scale    = transform.getScale();
+
+    m_positionX.push_back(position.x);
+    m_positionY.push_back(position.y);
+    m_positionZ.push_back(position.z);
+    m_rotationX.push_back(rotation.x);
+    m_rotationY.push_back(rotation.y);
+    m_rotationZ.push_back(rotation.z);
+    m_rotationW.push_back(rotation.w);
+    m_scaleX.push_back(scale.x);
+    m_scaleY.push_back(scale.y);
+    m_scaleZ.push_back(scale.z);
+  }
+
+  /** @brief Appends the state recorded by a transform history to the batch */
+  void TransformBatch::push(const TransformHistory &history) {
+    m_positionX.push_back(history.position.x);
+    m_positionY.push_back(history.position.y);
+    m_positionZ.push_back(history.position.z);
+    m_rotationX.push_back(history.rotation.x);
+    m_rotationY.push_back(history.rotation.y);
+    m_rotationZ.push_back(history.rotation.z);
+    m_rotationW.push_back(history.rotation.w);
+    m_scaleX.push_back(history.scale.x);
+    m_scaleY.push_back(history.scale.y);
+    m_scaleZ.push_back(history.scale.z);
+  }
+
+  glm::vec3 TransformBatch::getPosition(size_t index) const {
+    return {m_positionX[index], m_positionY[index], m_positionZ[index]};
+  }
+
+  glm::quat TransformBatch::getRotation(size_t index) const {
+    return {m_rotationW[index], m_rotationX[index], m_rotationY[index], m_rotationZ[index]};
+  }
+
+  glm::vec3 TransformBatch::getScale(size_t index) const {
+    return {m_scaleX[index], m_scaleY[index], m_scaleZ[index]};
+  }
+
+  /**
+   * @brief Moves every transform in the batch to the given fraction of the way from its previous
+   * state, matching TransformHistory::interpolate(). Positions and scales are interpolated
+   * linearly and rotations are normalised linear interpolations along the shorter arc.
+   * @param previous Previous states, holding the same transforms in the same order
+   * @param alpha Fraction of the way from the previous to the current state, from 0 to 1
+   */
+  void TransformBatch::interpolate(const TransformBatch &previous, float alpha) {
+    interpolate(previous, alpha, s_simdLevel);
+  }
+
+  /**
+   * @brief Interpolates every transform in the batch with the given instruction set, falling back
+   * to narrower ones for any remainder, see interpolate()
+   * @param level Instruction set to use, clamped to what the CPU supports
+   */
+  void TransformBatch::interpolate(const TransformBatch &previous, float alpha,
+                                   SimdUtils::Level level) {
+    level = std::min(level, SimdUtils::GetSupportedLevel());
+
+    size_t nDone = 0;
+#ifdef TRITIUM_SIMD_X86
+    if (level == SimdUtils::Level::AVX2)
+      nDone = interpolateAvx2(previous, alpha);
+    else if (level == SimdUtils::Level::SSE4)
+      nDone = interpolateSse4(previous, alpha);
+#endif
+    interpolateScalar(previous, alpha, nDone, size());
+  }
+
+  /**
+   * @brief Calculates the model matrix of every transform in the batch, matching
+   * Transform::getModelMatrix()
+   * @param models Output array holding at least size() matrices
+   */
+  void TransformBatch::calcModelMatrices(glm::mat4 *models) const {
+    calcModelMatrices(models, s_simdLevel);
+  }
+
+  /**
+   * @brief Caches calculated model matrices in the transforms they were calculated from, which
+   * must be the transforms pushed to the batch in the same order
+   * @param models Matrices calculated by calcModelMatrices()
+   * @param transforms The transforms the batch was filled from
+   * @param count Number of matrices to store
+   */
+  void TransformBatch::storeModelMatrices(const glm::mat4 *models, Transform *const *transforms,
+                                          size_t count) {
+    for (size_t i = 0; i < count; ++i)
+      transforms[i]->setModelMatrix(models[i]);
+  }
+
+  /**
+   * @brief Calculates the model matrix of every transform in the batch with the given instruction
+   * set, falling back to narrower ones for any remainder
+   * @param models Output array holding at least size() matrices
+   * @param level Instruction set to use, clamped to what the CPU supports
+   */
+  void TransformBatch::calcModelMatrices(glm::mat4 *models, SimdUtils::Level level) const {
+    level = std::min(level, SimdUtils::GetSupportedLevel());
+
+    size_t nDone = 0;
+#ifdef TRITIUM_SIMD_X86
+    if (level == SimdUtils::Level::AVX2)
+      nDone = calcAvx2(models);
+    else if (level == SimdUtils::Level::SSE4)
+      nDone = calcSse4(models);
+#endif
+    calcScalar(models, nDone, size());
+  }
+
+  /** @brief Selects the instruction set used by default, clamped to what the CPU supports */
+  void TransformBatch::setSimdLevel(SimdUtils::Level level) {
+    if (level > SimdUtils::GetSupportedLevel()) {
+      Logger::warn("[TransformBatch] {} is not supported by this CPU, using {} instead.",
+                   SimdUtils::GetLevelName(level),
+                   SimdUtils::GetLevelName(SimdUtils::GetSupportedLevel()));
+      level = SimdUtils::GetSupportedLevel();
+    }
+    s_simdLevel = level;
+  }
+
+  void TransformBatch::interpolateScalar(const TransformBatch &previous, float alpha,
+                                         size_t begin, size_t end) {
+    auto lerp = [alpha](float from, float to) { return from + (to - from) * alpha; };
+
+    for (size_t i = begin; i < end; ++i) {
+      m_positionX[i] = lerp(previous.m_positionX[i], m_positionX[i]);
+      m_positionY[i] = lerp(previous.m_positionY[i], m_positionY[i]);
+      m_positionZ[i] = lerp(previous.m_positionZ[i], m_positionZ[i]);
+      m_scaleX[i]    = lerp(previous.m_scaleX[i], m_scaleX[i]);
+      m_scaleY[i]    = lerp(previous.m_scaleY[i], m_scaleY[i]);
+      m_scaleZ[i]    = lerp(previous.m_scaleZ[i], m_scaleZ[i]);
+
+      // q and -q are the same rotation, flip the current one if it lies on the longer arc
+      float px   = previous.m_rotationX[i], py = previous.m_rotationY[i];
+      float pz   = previous.m_rotationZ[i], pw = previous.m_rotationW[i];
+      float qx   = m_rotationX[i], qy = m_rotationY[i], qz = m_rotationZ[i], qw = m_rotationW[i];
+      float sign = px * qx + py * qy + pz * qz + pw * qw < 0.f ? -1.f : 1.f;
+
+      float rx = lerp(px, qx * sign), ry = lerp(py, qy * sign);
+      float rz = lerp(pz, qz * sign), rw = lerp(pw, qw * sign);
+
+      float invLength = 1.f / std::sqrt(rx * rx + ry * ry + rz * rz + rw * rw);
+      m_rotationX[i]  = rx * invLength;
+      m_rotationY[i]  = ry * invLength;
+      m_rotationZ[i]  = rz * invLength;
+      m_rotationW[i]  = rw * invLength;
+    }
+  }
+
+  void TransformBatch::calcScalar(glm::mat4 *models, size_t begin, size_t end) const {
+    for (size_t i = begin; i < end; ++i) {
+      float x2 = m_rotationX[i] * 2.f, y2 = m_rotationY[i] * 2.f, z2 = m_rotationZ[i] * 2.f;
+      float xx = m_rotationX[i] * x2, yy = m_rotationY[i] * y2, zz = m_rotationZ[i] * z2;
+      float xy = m_rotationX[i] * y2, xz = m_rotationX[i] * z2, yz = m_rotationY[i] * z2;
+      float wx = m_rotationW[i] * x2, wy = m_rotationW[i] * y2, wz = m_rotationW[i] * z2;
+
+      float sx = m_scaleX[i], sy = m_scaleY[i], sz = m_scaleZ[i];
+      models[i] = glm::mat4{
+          {sx * (1.f - yy - zz), sx * (xy + wz), sx * (xz - wy), 0.f},
+          {sy * (xy - wz), sy * (1.f - xx - zz), sy * (yz + wx), 0.f},
+          {sz * (xz + wy), sz * (yz - wx), sz * (1.f - xx - yy), 0.f},
+          {m_positionX[i], m_positionY[i], m_positionZ[i], 1.f}
+      };
+    }
+  }
+
+#ifdef TRITIUM_SIMD_X86
+  /** @return Number of transforms interpolated, always a multiple of 4 */
+  TRITIUM_TARGET_SSE4 size_t TransformBatch::interpolateSse4(const TransformBatch &previous,
+                                                             float alpha) {
+    const size_t count    = size() & ~size_t(3);
+    const __m128 t        = _mm_set1_ps(alpha);
+    const __m128 one      = _mm_set1_ps(1.f);
+    const __m128 signMask = _mm_set1_ps(-0.f);
+
+    for (size_t i = 0; i < count; i += 4) {
+      lerpStore4(&m_positionX[i], &previous.m_positionX[i], t);
+      lerpStore4(&m_positionY[i], &previous.m_positionY[i], t);
+      lerpStore4(&m_positionZ[i], &previous.m_positionZ[i], t);
+      lerpStore4(&m_scaleX[i], &previous.m_scaleX[i], t);
+      lerpStore4(&m_scaleY[i], &previous.m_scaleY[i], t);
+      lerpStore4(&m_scaleZ[i], &previous.m_scaleZ[i], t);
+
+      __m128 px = _mm_loadu_ps(&previous.m_rotationX[i]);
+      __m128 py = _mm_loadu_ps(&previous.m_rotationY[i]);
+      __m128 pz = _mm_loadu_ps(&previous.m_rotationZ[i]);
+      __m128 pw = _mm_loadu_ps(&previous.m_rotationW[i]);
+      __m128 qx = _mm_loadu_ps(&m_rotationX[i]);
+      __m128 qy = _mm_loadu_ps(&m_rotationY[i]);
+      __m128 qz = _mm_loadu_ps(&m_rotationZ[i]);
+      __m128 qw = _mm_loadu_ps(&m_rotationW[i]);
+
+      // Flipping the sign bit of the current rotation where the dot product is negative keeps
+      // every interpolation on the shorter arc
+      __m128 dot  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, qx), _mm_mul_ps(py, qy)),
+                               _mm_add_ps(_mm_mul_ps(pz, qz), _mm_mul_ps(pw, qw)));
+      __m128 sign = _mm_and_ps(dot, signMask);
+
+      __m128 rx = lerp4(px, _mm_xor_ps(qx, sign), t);
+      __m128 ry = lerp4(py, _mm_xor_ps(qy, sign), t);
+      __m128 rz = lerp4(pz, _mm_xor_ps(qz, sign), t);
+      __m128 rw = lerp4(pw, _mm_xor_ps(qw, sign), t);
+
+      __m128 length2   = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)),
+                                    _mm_add_ps(_mm_mul_ps(rz, rz), _mm_mul_ps(rw, rw)));
+      __m128 invLength = _mm_div_ps(one, _mm_sqrt_ps(length2));
+      _mm_storeu_ps(&m_rotationX[i], _mm_mul_ps(rx, invLength));
+      _mm_storeu_ps(&m_rotationY[i], _mm_mul_ps(ry, invLength));
+      _mm_storeu_ps(&m_rotationZ[i], _mm_mul_ps(rz, invLength));
+      _mm_storeu_ps(&m_rotationW[i], _mm_mul_ps(rw, invLength));
+    }
+    return count;
+  }
+
+  /** @return Number of transforms interpolated, always a multiple of 8 */
+  TRITIUM_TARGET_AVX2 size_t TransformBatch::interpolateAvx2(const TransformBatch &previous,
+                                                             float alpha) {
+    const size_t count    = size() & ~size_t(7);
+    const __m256 t        = _mm256_set1_ps(alpha);
+    const __m256 one      = _mm256_set1_ps(1.f);
+    const __m256 signMask = _mm256_set1_ps(-0.f);
+
+    for (size_t i = 0; i < count; i += 8) {
+      lerpStore8(&m_positionX[i], &previous.m_positionX[i], t);
+      lerpStore8(&m_positionY[i], &previous.m_positionY[i], t);
+      lerpStore8(&m_positionZ[i], &previous.m_positionZ[i], t);
+      lerpStore8(&m_scaleX[i], &previous.m_scaleX[i], t);
+      lerpStore8(&m_scaleY[i], &previous.m_scaleY[i], t);
+      lerpStore8(&m_scaleZ[i], &previous.m_scaleZ[i], t);
+
+      __m256 px = _mm256_loadu_ps(&previous.m_rotationX[i]);
+      __m256 py = _mm256_loadu_ps(&previous.m_rotationY[i]);
+      __m256 pz = _mm256_loadu_ps(&previous.m_rotationZ[i]);
+      __m256 pw = _mm256_loadu_ps(&previous.m_rotationW[i]);
+      __m256 qx = _mm256_loadu_ps(&m_rotationX[i]);
+      __m256 qy = _mm256_loadu_ps(&m_rotationY[i]);
+      __m256 qz = _mm256_loadu_ps(&m_rotationZ[i]);
+      __m256 qw = _mm256_loadu_ps(&m_rotationW[i]);
+
+      // See interpolateSse4
+      __m256 dot  = _mm256_mul_ps(px, qx);
+      dot         = _mm256_fmadd_ps(py, qy, dot);
+      dot         = _mm256_fmadd_ps(pz, qz, dot);
+      dot         = _mm256_fmadd_ps(pw, qw, dot);
+      __m256 sign = _mm256_and_ps(dot, signMask);
+
+      __m256 rx = lerp8(px, _mm256_xor_ps(qx, sign), t);
+      __m256 ry = lerp8(py, _mm256_xor_ps(qy, sign), t);
+      __m256 rz = lerp8(pz, _mm256_xor_ps(qz, sign), t);
+      __m256 rw = lerp8(pw, _mm256_xor_ps(qw, sign), t);
+
+      __m256 length2   = _mm256_mul_ps(rx, rx);
+      length2          = _mm256_fmadd_ps(ry, ry, length2);
+      length2          = _mm256_fmadd_ps(rz, rz, length2);
+      length2          = _mm256_fmadd_ps(rw, rw, length2);
+      __m256 invLength = _mm256_div_ps(one, _mm256_sqrt_ps(length2));
+      _mm256_storeu_ps(&m_rotationX[i], _mm256_mul_ps(rx, invLength));
+      _mm256_storeu_ps(&m_rotationY[i], _mm256_mul_ps(ry, invLength));
+      _mm256_storeu_ps(&m_rotationZ[i], _mm256_mul_ps(rz, invLength));
+      _mm256_storeu_ps(&m_rotationW[i], _mm256_mul_ps(rw, invLength));
+    }
+    return count;
+  }
+
+  /** @return Number of matrices calculated, always a multiple of 4 */
+  TRITIUM_TARGET_SSE4 size_t TransformBatch::calcSse4(glm::mat4 *models) const {
+    const size_t count = size() & ~size_t(3);
+    const __m128 one   = _mm_set1_ps(1.f);
+    const __m128 zero  = _mm_setzero_ps();
+
+    for (size_t i = 0; i < count; i += 4) {
+      __m128 qx = _mm_loadu_ps(&m_rotationX[i]);
+      __m128 qy = _mm_loadu_ps(&m_rotationY[i]);
+      __m128 qz = _mm_loadu_ps(&m_rotationZ[i]);
+      __m128 qw = _mm_loadu_ps(&m_rotationW[i]);
+      __m128 x2 = _mm_add_ps(qx, qx);
+      __m128 y2 = _mm_add_ps(qy, qy);
+      __m128 z2 = _mm_add_ps(qz, qz);
+
+      __m128 xx = _mm_mul_ps(qx, x2), yy = _mm_mul_ps(qy, y2), zz = _mm_mul_ps(qz, z2);
+      __m128 xy = _mm_mul_ps(qx, y2), xz = _mm_mul_ps(qx, z2), yz = _mm_mul_ps(qy, z2);
+      __m128 wx = _mm_mul_ps(qw, x2), wy = _mm_mul_ps(qw, y2), wz = _mm_mul_ps(qw, z2);
+
+      __m128 sx = _mm_loadu_ps(&m_scaleX[i]);
+      __m128 sy = _mm_loadu_ps(&m_scaleY[i]);
+      __m128 sz = _mm_loadu_ps(&m_scaleZ[i]);
+
+      float *out = &models[i][0][0];
+      storeColumn4(out, 0, _mm_mul_ps(sx, _mm_sub_ps(one, _mm_add_ps(yy, zz))),
+                   _mm_mul_ps(sx, _mm_add_ps(xy, wz)), _mm_mul_ps(sx, _mm_sub_ps(xz, wy)), zero);
+      storeColumn4(out, 1, _mm_mul_ps(sy, _mm_sub_ps(xy, wz)),
+                   _mm_mul_ps(sy, _mm_sub_ps(one, _mm_add_ps(xx, zz))),
+                   _mm_mul_ps(sy, _mm_add_ps(yz, wx)), zero);
+      storeColumn4(out, 2, _mm_mul_ps(sz, _mm_add_ps(xz, wy)), _mm_mul_ps(sz, _mm_sub_ps(yz, wx)),
+                   _mm_mul_ps(sz, _mm_sub_ps(one, _mm_add_ps(xx, yy))), zero);
+      storeColumn4(out, 3, _mm_loadu_ps(&m_positionX[i]), _mm_loadu_ps(&m_positionY[i]),
+                   _mm_loadu_ps(&m_positionZ[i]), one);
+    }
+    return count;
+  }
+
+  /** @return Number of matrices calculated, always a multiple of 8 */
+  TRITIUM_TARGET_AVX2 size_t TransformBatch::calcAvx2(glm::mat4 *models) const {
+    const size_t count = size() & ~size_t(7);
+    const __m256 one   = _mm256_set1_ps(1.f);
+    const __m256 zero  = _mm256_setzero_ps();
+
+    for (size_t i = 0; i < count; i += 8) {
+      __m256 qx = _mm256_loadu_ps(&m_rotationX[i]);
+      __m256 qy = _mm256_loadu_ps(&m_rotationY[i]);
+      __m256 qz = _mm256_loadu_ps(&m_rotationZ[i]);
+      __m256 qw = _mm256_loadu_ps(&m_rotationW[i]);
+      __m256 x2 = _mm256_add_ps(qx, qx);
+      __m256 y2 = _mm256_add_ps(qy, qy);
+      __m256 z2 = _mm256_add_ps(qz, qz);
+
+      __m256 xx = _mm256_mul_ps(qx, x2), yy = _mm256_mul_ps(qy, y2), zz = _mm256_mul_ps(qz, z2);
+      __m256 xy = _mm256_mul_ps(qx, y2), xz = _mm256_mul_ps(qx, z2), yz = _mm256_mul_ps(qy, z2);
+      __m256 wx = _mm256_mul_ps(qw, x2), wy = _mm256_mul_ps(qw, y2), wz = _mm256_mul_ps(qw, z2);
+
+      __m256 sx = _mm256_loadu_ps(&m_scaleX[i]);
+      __m256 sy = _mm256_loadu_ps(&m_scaleY[i]);
+      __m256 sz = _mm256_loadu_ps(&m_scaleZ[i]);
+
+      // Diagonal terms are s * (1 - a - b), i.e. s - s * (a + b)
+      float *out = &models[i][0][0];
+      storeColumn8(out, 0, _mm256_fnmadd_ps(sx, _mm256_add_ps(yy, zz), sx),
+                   _mm256_mul_ps(sx, _mm256_add_ps(xy, wz)),
+                   _mm256_mul_ps(sx, _mm256_sub_ps(xz, wy)), zero);
+      storeColumn8(out, 1, _mm256_mul_ps(sy, _mm256_sub_ps(xy, wz)),
+                   _mm256_fnmadd_ps(sy, _mm256_add_ps(xx, zz), sy),
+                   _mm256_mul_ps(sy, _mm256_add_ps(yz, wx)), zero);
+      storeColumn8(out, 2, _mm256_mul_ps(sz, _mm256_add_ps(xz, wy)),
+                   _mm256_mul_ps(sz, _mm256_sub_ps(yz, wx)),
+                   _mm256_fnmadd_ps(sz, _mm256_add_ps(xx, yy), sz), zero);
+      storeColumn8(out, 3, _mm256_loadu_ps(&m_positionX[i]), _mm256_loadu_ps(&m_positionY[i]),
+                   _mm256_loadu_ps(&m_positionZ[i]), one);
+    }
+    return count;
+  }
+#else
+  size_t TransformBatch::interpolateSse4(const TransformBatch &previous, float alpha) { return 0; }
+  size_t TransformBatch::interpolateAvx2(const TransformBatch &previous, float alpha) { return 0; }
+  size_t TransformBatch::calcSse4(glm::mat4 *models) const { return 0; }
+  size_t TransformBatch::calcAvx2(glm::mat4 *models) const { return 0; }
+#endif
+} // namespace TritiumEngine::Core
\ No newline at end of file
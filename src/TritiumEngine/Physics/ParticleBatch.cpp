@@ -0,0 +1,141 @@
+#include <TritiumEngine/Physics/ParticleBatch.hpp>
+
+#ifdef TRITIUM_SIMD_X86
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+
+namespace TritiumEngine::Physics
+{
+  /** @brief Sets the number of particles in the batch, see set() */
+  void ParticleBatch::resize(size_t count) {
+    for (auto *values : {&m_positionX, &m_positionY, &m_positionZ, &m_velocityX, &m_velocityY,
+                         &m_velocityZ})
+      values->resize(count);
+    m_bounced.resize(count);
+  }
+
+  /**
+   * @brief Moves every particle in the batch by its velocity and mirrors particles that left a
+   * square box centred on the origin back inside, flipping their velocity on the crossed axes.
+   * Only x and y are bounded. Every particle takes the same branchless steps.
+   * @param halfBoxSize Distance from the centre of the box to its walls
+   * @param dt Time step to move the particles by
+   */
+  void ParticleBatch::reflectInBox(float halfBoxSize, float dt) {
+    reflectInBox(halfBoxSize, dt, SimdUtils::GetSupportedLevel());
+  }
+
+  /**
+   * @brief Moves and reflects every particle in the batch with the given instruction set, falling
+   * back to narrower ones for any remainder, see reflectInBox()
+   * @param level Instruction set to use, clamped to what the CPU supports
+   */
+  void ParticleBatch::reflectInBox(float halfBoxSize, float dt, SimdUtils::Level level) {
+    level = std::min(level, SimdUtils::GetSupportedLevel());
+
+    size_t nDone = 0;
+#ifdef TRITIUM_SIMD_X86
+    if (level == SimdUtils::Level::AVX2)
+      nDone = reflectAvx2(halfBoxSize, dt);
+    else if (level == SimdUtils::Level::SSE4)
+      nDone = reflectSse4(halfBoxSize, dt);
+#endif
+    reflectScalar(halfBoxSize, dt, nDone, size());
+  }
+
+  void ParticleBatch::reflectScalar(float halfBoxSize, float dt, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      float x = m_positionX[i] + m_velocityX[i] * dt;
+      float y = m_positionY[i] + m_velocityY[i] * dt;
+      float z = m_positionZ[i] + m_velocityZ[i] * dt;
+
+      // Distance past each wall, zero when inside the box
+      float outsideX = std::max(x - halfBoxSize, 0.f) + std::min(x + halfBoxSize, 0.f);
+      float outsideY = std::max(y - halfBoxSize, 0.f) + std::min(y + halfBoxSize, 0.f);
+
+      m_positionX[i] = x - 2.f * outsideX;
+      m_positionY[i] = y - 2.f * outsideY;
+      m_positionZ[i] = z;
+      m_velocityX[i] = outsideX != 0.f ? -m_velocityX[i] : m_velocityX[i];
+      m_velocityY[i] = outsideY != 0.f ? -m_velocityY[i] : m_velocityY[i];
+      m_bounced[i]   = outsideX != 0.f || outsideY != 0.f ? ~0u : 0u;
+    }
+  }
+
+#ifdef TRITIUM_SIMD_X86
+  TRITIUM_TARGET_SSE4 size_t ParticleBatch::reflectSse4(float halfBoxSize, float dt) {
+    const size_t count   = size() & ~size_t(3);
+    const __m128 dtVec   = _mm_set1_ps(dt);
+    const __m128 maxWall = _mm_set1_ps(halfBoxSize);
+    const __m128 minWall = _mm_set1_ps(-halfBoxSize);
+    const __m128 zero    = _mm_setzero_ps();
+    const __m128 sign    = _mm_set1_ps(-0.f);
+
+    for (size_t i = 0; i < count; i += 4) {
+      __m128 vx = _mm_loadu_ps(&m_velocityX[i]);
+      __m128 vy = _mm_loadu_ps(&m_velocityY[i]);
+      __m128 vz = _mm_loadu_ps(&m_velocityZ[i]);
+      __m128 x  = _mm_add_ps(_mm_loadu_ps(&m_positionX[i]), _mm_mul_ps(vx, dtVec));
+      __m128 y  = _mm_add_ps(_mm_loadu_ps(&m_positionY[i]), _mm_mul_ps(vy, dtVec));
+      __m128 z  = _mm_add_ps(_mm_loadu_ps(&m_positionZ[i]), _mm_mul_ps(vz, dtVec));
+
+      // Distance past each wall, zero when inside the box
+      __m128 outsideX = _mm_add_ps(_mm_max_ps(_mm_sub_ps(x, maxWall), zero),
+                                   _mm_min_ps(_mm_sub_ps(x, minWall), zero));
+      __m128 outsideY = _mm_add_ps(_mm_max_ps(_mm_sub_ps(y, maxWall), zero),
+                                   _mm_min_ps(_mm_sub_ps(y, minWall), zero));
+      __m128 bouncedX = _mm_cmpneq_ps(outsideX, zero);
+      __m128 bouncedY = _mm_cmpneq_ps(outsideY, zero);
+
+      // Mirror back inside the box and flip the velocity on bounced axes
+      _mm_storeu_ps(&m_positionX[i], _mm_sub_ps(x, _mm_add_ps(outsideX, outsideX)));
+      _mm_storeu_ps(&m_positionY[i], _mm_sub_ps(y, _mm_add_ps(outsideY, outsideY)));
+      _mm_storeu_ps(&m_positionZ[i], z);
+      _mm_storeu_ps(&m_velocityX[i], _mm_xor_ps(vx, _mm_and_ps(bouncedX, sign)));
+      _mm_storeu_ps(&m_velocityY[i], _mm_xor_ps(vy, _mm_and_ps(bouncedY, sign)));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(&m_bounced[i]),
+                       _mm_castps_si128(_mm_or_ps(bouncedX, bouncedY)));
+    }
+    return count;
+  }
+
+  TRITIUM_TARGET_AVX2 size_t ParticleBatch::reflectAvx2(float halfBoxSize, float dt) {
+    const size_t count   = size() & ~size_t(7);
+    const __m256 dtVec   = _mm256_set1_ps(dt);
+    const __m256 maxWall = _mm256_set1_ps(halfBoxSize);
+    const __m256 minWall = _mm256_set1_ps(-halfBoxSize);
+    const __m256 zero    = _mm256_setzero_ps();
+    const __m256 sign    = _mm256_set1_ps(-0.f);
+
+    for (size_t i = 0; i < count; i += 8) {
+      __m256 vx = _mm256_loadu_ps(&m_velocityX[i]);
+      __m256 vy = _mm256_loadu_ps(&m_velocityY[i]);
+      __m256 vz = _mm256_loadu_ps(&m_velocityZ[i]);
+      __m256 x  = _mm256_fmadd_ps(vx, dtVec, _mm256_loadu_ps(&m_positionX[i]));
+      __m256 y  = _mm256_fmadd_ps(vy, dtVec, _mm256_loadu_ps(&m_positionY[i]));
+      __m256 z  = _mm256_fmadd_ps(vz, dtVec, _mm256_loadu_ps(&m_positionZ[i]));
+
+      __m256 outsideX = _mm256_add_ps(_mm256_max_ps(_mm256_sub_ps(x, maxWall), zero),
+                                      _mm256_min_ps(_mm256_sub_ps(x, minWall), zero));
+      __m256 outsideY = _mm256_add_ps(_mm256_max_ps(_mm256_sub_ps(y, maxWall), zero),
+                                      _mm256_min_ps(_mm256_sub_ps(y, minWall), zero));
+      __m256 bouncedX = _mm256_cmp_ps(outsideX, zero, _CMP_NEQ_UQ);
+      __m256 bouncedY = _mm256_cmp_ps(outsideY, zero, _CMP_NEQ_UQ);
+
+      _mm256_storeu_ps(&m_positionX[i], _mm256_sub_ps(x, _mm256_add_ps(outsideX, outsideX)));
+      _mm256_storeu_ps(&m_positionY[i], _mm256_sub_ps(y, _mm256_add_ps(outsideY, outsideY)));
+      _mm256_storeu_ps(&m_positionZ[i], z);
+      _mm256_storeu_ps(&m_velocityX[i], _mm256_xor_ps(vx, _mm256_and_ps(bouncedX, sign)));
+      _mm256_storeu_ps(&m_velocityY[i], _mm256_xor_ps(vy, _mm256_and_ps(bouncedY, sign)));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(&m_bounced[i]),
+                          _mm256_castps_si256(_mm256_or_ps(bouncedX, bouncedY)));
+    }
+    return count;
+  }
+#else
+  size_t ParticleBatch::reflectSse4(float halfBoxSize, float dt) { return 0; }
+  size_t ParticleBatch::reflectAvx2(float halfBoxSize, float dt) { return 0; }
+#endif
+} // namespace TritiumEngine::Physics
\ No newline at end of file
@@ -0,0 +1,301 @@
+#include <TritiumEngine/Core/Application.hpp>
+#include <TritiumEngine/Core/Components/Rigidbody.hpp>
+#include <TritiumEngine/Core/Components/Transform.hpp>
+#include <TritiumEngine/Physics/Collider.hpp>
+#include <TritiumEngine/Physics/Components/AABB.hpp>
+#include <TritiumEngine/Physics/Systems/CollisionSystem.hpp>
+#include <TritiumEngine/Utilities/Logger.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+using namespace TritiumEngine::Utilities;
+
+namespace
+{
+  using Clock = std::chrono::high_resolution_clock;
+
+  float getElapsedMs(Clock::time_point &start) {
+    auto now = Clock::now();
+    float ms = std::chrono::duration<float, std::milli>(now - start).count();
+    start    = now;
+    return ms;
+  }
+} // namespace
+
+namespace TritiumEngine::Physics
+{
+  CollisionSystem::CollisionSystem(const glm::vec2 &boundsMin, const glm::vec2 &boundsMax,
+                                   float cellSize)
+      : System(), m_boundsMin(boundsMin), m_boundsMax(boundsMax), m_cellSize(cellSize) {
+    m_gridSize = glm::max(glm::ivec2(glm::ceil((m_boundsMax - m_boundsMin) / m_cellSize)), 1);
+
+    reads<AABB>();
+    writes<Transform, Rigidbody>();
+  }
+
+  void CollisionSystem::update(float dt) {
+    auto start = Clock::now();
+
+    integrate(dt);
+    m_stats.integrateMs = getElapsedMs(start);
+
+    buildGrid();
+    m_stats.broadphaseMs = getElapsedMs(start);
+
+    findPairs();
+    m_stats.narrowphaseMs = getElapsedMs(start);
+
+    resolvePairs();
+    m_stats.responseMs = getElapsedMs(start);
+
+    m_stats.nBodies = m_bodies.size();
+    m_stats.nPairs  = m_pairs.size();
+  }
+
+  // Moves all bodies, reflects them off the bounds and packs them for the following phases
+  void CollisionSystem::integrate(float dt) {
+    auto view = m_app->registry.view<Transform, Rigidbody, AABB>();
+    m_entities.assign(view.begin(), view.end());
+    m_bodies.resize(m_entities.size());
+
+    m_app->jobSystem.parallelFor(m_entities.size(), [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        auto [transform, rigidbody, aabb] = view.get(m_entities[i]);
+
+        glm::vec2 halfExtents = aabb.getHalfExtents();
+        glm::vec2 velocity    = rigidbody.velocity;
+        glm::vec2 position    = glm::vec2(transform.getPosition()) + velocity * dt;
+
+        glm::vec2 min = m_boundsMin + halfExtents;
+        glm::vec2 max = m_boundsMax - halfExtents;
+        for (int axis = 0; axis < 2; ++axis) {
+          if (position[axis] < min[axis]) {
+            position[axis] = 2.f * min[axis] - position[axis];
+            velocity[axis] = std::abs(velocity[axis]);
+          } else if (position[axis] > max[axis]) {
+            position[axis] = 2.f * max[axis] - position[axis];
+            velocity[axis] = -std::abs(velocity[axis]);
+          }
+        }
+
+        float inverseMass = rigidbody.mass > 0.f ? 1.f / rigidbody.mass : 0.f;
+        m_bodies[i]       = {position, halfExtents, velocity, inverseMass};
+      }
+    });
+  }
+
+  /**
+   * @brief Counting sort of body indices by grid cell. Bodies are counted and scattered by
+   * concurrent jobs through atomic counters, so each cell's bodies are sorted by index afterwards
+   * to keep the order of pairs, and thus the simulation, independent of scheduling. Cell offsets
+   * are summed per chunk of cells first, then offset by the preceding chunks.
+   */
+  void CollisionSystem::buildGrid() {
+    auto &jobSystem = m_app->jobSystem;
+    size_t nCells   = static_cast<size_t>(m_gridSize.x) * m_gridSize.y;
+    m_cellStart.assign(nCells + 1, 0);
+    m_cellCursors.resize(nCells);
+    m_bodyCells.resize(m_bodies.size());
+    m_cellBodies.resize(m_bodies.size());
+
+    jobSystem.parallelFor(m_bodies.size(), [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        m_bodyCells[i] = getCellIndex(m_bodies[i].position);
+        std::atomic_ref<uint32_t>(m_cellStart[m_bodyCells[i] + 1])
+            .fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+
+    size_t chunkSize = jobSystem.getChunkSize(nCells);
+    size_t nChunks   = (nCells + chunkSize - 1) / chunkSize;
+    m_chunkCounts.resize(nChunks);
+
+    jobSystem.parallelFor(
+        nCells,
+        [&](size_t begin, size_t end) {
+          uint32_t count = 0;
+          for (size_t cell = begin; cell < end; ++cell)
+            count += m_cellStart[cell + 1];
+          m_chunkCounts[begin / chunkSize] = count;
+        },
+        chunkSize);
+
+    uint32_t nPreceding = 0;
+    for (auto &count : m_chunkCounts)
+      nPreceding += std::exchange(count, nPreceding);
+
+    // Cursors start at the first index of their cell and run up to the next cell's
+    jobSystem.parallelFor(
+        nCells,
+        [&](size_t begin, size_t end) {
+          uint32_t start = m_chunkCounts[begin / chunkSize];
+          for (size_t cell = begin; cell < end; ++cell) {
+            m_cellCursors[cell] = start;
+            start += m_cellStart[cell + 1];
+            m_cellStart[cell + 1] = start;
+          }
+        },
+        chunkSize);
+
+    jobSystem.parallelFor(m_bodies.size(), [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        uint32_t index = std::atomic_ref<uint32_t>(m_cellCursors[m_bodyCells[i]])
+                             .fetch_add(1, std::memory_order_relaxed);
+        m_cellBodies[index] = static_cast<uint32_t>(i);
+      }
+    });
+
+    jobSystem.parallelFor(
+        nCells,
+        [&](size_t begin, size_t end) {
+          for (size_t cell = begin; cell < end; ++cell) {
+            if (m_cellStart[cell + 1] - m_cellStart[cell] > 1)
+              std::sort(&m_cellBodies[m_cellStart[cell]], &m_cellBodies[m_cellStart[cell + 1]]);
+          }
+        },
+        chunkSize);
+  }
+
+  /**
+   * @brief Tests the bodies of each cell against bodies in their own and neighbouring cells, each
+   * pair is only found once. Pairs are collected per cell, along with the resolve pass of the cell.
+   */
+  void CollisionSystem::findPairs() {
+    // Each chunk of cells collects its pairs separately, they are joined once all have finished
+    size_t nCells    = m_cellStart.size() - 1;
+    size_t chunkSize = m_app->jobSystem.getChunkSize(nCells);
+    size_t nChunks   = (nCells + chunkSize - 1) / chunkSize;
+    m_chunkPairs.resize(nChunks);
+    m_chunkRanges.resize(nChunks);
+
+    m_app->jobSystem.parallelFor(
+        nCells,
+        [&](size_t begin, size_t end) {
+          auto &pairs  = m_chunkPairs[begin / chunkSize];
+          auto &ranges = m_chunkRanges[begin / chunkSize];
+          pairs.clear();
+          for (auto &passRanges : ranges)
+            passRanges.clear();
+
+          for (size_t cell = begin; cell < end; ++cell) {
+            if (m_cellStart[cell] == m_cellStart[cell + 1])
+              continue;
+
+            int cellX = static_cast<int>(cell % m_gridSize.x);
+            int cellY = static_cast<int>(cell / m_gridSize.x);
+            int minX  = std::max(cellX - 1, 0);
+            int maxX  = std::min(cellX + 1, m_gridSize.x - 1);
+            int minY  = std::max(cellY - 1, 0);
+            int maxY  = std::min(cellY + 1, m_gridSize.y - 1);
+
+            auto rangeStart = static_cast<uint32_t>(pairs.size());
+            for (uint32_t k = m_cellStart[cell]; k < m_cellStart[cell + 1]; ++k) {
+              uint32_t i    = m_cellBodies[k];
+              const Body &a = m_bodies[i];
+
+              for (int y = minY; y <= maxY; ++y) {
+                for (int x = minX; x <= maxX; ++x) {
+                  size_t other = static_cast<size_t>(y) * m_gridSize.x + x;
+                  for (uint32_t l = m_cellStart[other]; l < m_cellStart[other + 1]; ++l) {
+                    uint32_t j = m_cellBodies[l];
+                    if (j <= i)
+                      continue;
+
+                    const Body &b = m_bodies[j];
+                    if (Collider::CheckCollision(a.position, a.halfExtents, b.position,
+                                                 b.halfExtents))
+                      pairs.emplace_back(i, j);
+                  }
+                }
+              }
+            }
+
+            if (pairs.size() > rangeStart)
+              ranges[cellX % 3 + 3 * (cellY % 3)].push_back(
+                  {rangeStart, static_cast<uint32_t>(pairs.size())});
+          }
+        },
+        chunkSize);
+
+    m_pairs.clear();
+    for (auto &passRanges : m_passRanges)
+      passRanges.clear();
+
+    for (size_t chunk = 0; chunk < nChunks; ++chunk) {
+      auto offset = static_cast<uint32_t>(m_pairs.size());
+      m_pairs.insert(m_pairs.end(), m_chunkPairs[chunk].begin(), m_chunkPairs[chunk].end());
+      for (size_t pass = 0; pass < N_RESOLVE_PASSES; ++pass) {
+        for (const auto &range : m_chunkRanges[chunk][pass])
+          m_passRanges[pass].push_back({range.start + offset, range.end + offset});
+      }
+    }
+  }
+
+  /**
+   * @brief Resolves all pairs, then writes the bodies back to their entities. Pairs only join
+   * bodies of neighbouring cells, so the pairs of cells at least 3 cells apart on either axis
+   * never share a body. Each pass resolves the cells of one combination of coordinates modulo 3
+   * concurrently, while the pairs of a single cell stay in order within one job.
+   */
+  void CollisionSystem::resolvePairs() {
+    for (const auto &ranges : m_passRanges) {
+      m_app->jobSystem.parallelFor(ranges.size(), [&](size_t begin, size_t end) {
+        for (size_t r = begin; r < end; ++r) {
+          for (uint32_t p = ranges[r].start; p < ranges[r].end; ++p)
+            resolvePair(m_pairs[p].first, m_pairs[p].second);
+        }
+      });
+    }
+
+    // Write results back to the entities the bodies were packed from
+    auto view = m_app->registry.view<Transform, Rigidbody>();
+    m_app->jobSystem.parallelFor(m_entities.size(), [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        auto [transform, rigidbody] = view.get(m_entities[i]);
+        const Body &body            = m_bodies[i];
+        transform.setPosition({body.position, transform.getPosition().z});
+        rigidbody.velocity = {body.velocity, rigidbody.velocity.z};
+      }
+    });
+  }
+
+  // Separates colliding bodies along the axis of least penetration and exchanges momentum
+  void CollisionSystem::resolvePair(uint32_t i, uint32_t j) {
+    Body &a = m_bodies[i];
+    Body &b = m_bodies[j];
+
+    float totalInverseMass = a.inverseMass + b.inverseMass;
+    if (totalInverseMass <= 0.f)
+      return;
+
+    glm::vec2 penetration =
+        Collider::GetPenetration(a.position, a.halfExtents, b.position, b.halfExtents);
+    if (penetration.x <= 0.f || penetration.y <= 0.f)
+      return; // Already separated by an earlier pair
+
+    int axis     = penetration.x < penetration.y ? 0 : 1;
+    float normal = b.position[axis] >= a.position[axis] ? 1.f : -1.f;
+
+    // Push bodies apart in proportion to their inverse masses
+    float correction = penetration[axis] / totalInverseMass;
+    a.position[axis] -= normal * correction * a.inverseMass;
+    b.position[axis] += normal * correction * b.inverseMass;
+
+    // Perfectly elastic impulse, only applied if the bodies are moving towards each other
+    float relativeVelocity = (b.velocity[axis] - a.velocity[axis]) * normal;
+    if (relativeVelocity >= 0.f)
+      return;
+
+    float impulse = -2.f * relativeVelocity / totalInverseMass;
+    a.velocity[axis] -= normal * impulse * a.inverseMass;
+    b.velocity[axis] += normal * impulse * b.inverseMass;
+  }
+
+  uint32_t CollisionSystem::getCellIndex(const glm::vec2 &position) const {
+    glm::ivec2 cell = glm::ivec2(glm::floor((position - m_boundsMin) / m_cellSize));
+    cell            = glm::clamp(cell, glm::ivec2(0), m_gridSize - 1);
+    return static_cast<uint32_t>(cell.y * m_gridSize.x + cell.x);
+  }
+} // namespace TritiumEngine::Physics
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include <TritiumEngine/Rendering/Components/Camera.hpp>
+
+namespace TritiumEngine::Rendering
+{
+  /**
+   * @brief Obtains the projection and view matrices of the camera. Matrices are only recalculated
+   * if any of the camera properties changed since they were last obtained.
+   */
+  const CameraData &Camera::getCameraData() const {
+    State state = getState();
+    if (m_isCached && state == m_cachedState)
+      return m_cachedData;
+
+    m_cachedData.projection     = calcProjectionMatrix();
+    m_cachedData.view           = transform.getViewMatrix();
+    m_cachedData.projectionView = m_cachedData.projection * m_cachedData.view;
+    m_cachedState               = state;
+    m_isCached                  = true;
+    return m_cachedData;
+  }
+
+  /**
+   * @brief Binds the camera uniform buffer to the camera binding point, uploading the camera
+   * matrices first unless the buffer already holds matrices of an identical camera
+   */
+  void Camera::bindUniformBuffer() const {
+    if (!m_uniforms)
+      m_uniforms = std::make_shared<Uniforms>();
+
+    const CameraData &data = getCameraData();
+    if (!m_uniforms->isUploaded || m_uniforms->uploadedState != m_cachedState) {
+      m_uniforms->buffer.setData(&data, sizeof(CameraData));
+      m_uniforms->uploadedState = m_cachedState;
+      m_uniforms->isUploaded    = true;
+    }
+
+    m_uniforms->buffer.bind(UNIFORM_BINDING);
+  }
+
+  Camera::State Camera::getState() const {
+    return {projection, width, height, transform.getPosition(), transform.getRotation(),
+            transform.getScale(), nearPlane, farPlane, fov};
+  }
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -1,82 +1,403 @@
 #include <TritiumEngine/Rendering/Components/InstancedRenderable.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
 #include <TritiumEngine/Utilities/Logger.hpp>
 
 #include <GL/glew.h>
+#include <entt/entity/registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
 
 using namespace TritiumEngine::Utilities;
 
 namespace TritiumEngine::Rendering
 {
   InstancedRenderable::InstancedRenderable(unsigned int renderMode, const RenderData &renderData,
-                                           int count)
-      : m_nInstances(count), m_vertexStride(renderData.vertexStride), m_renderMode(renderMode),
-        m_ebo(0), m_instanceData(count) {
+                                           int count, UploadMode uploadMode, InstanceLayout layout)
+      : InstancedRenderable(renderMode, Mesh::get(renderData), count, uploadMode, layout) {}
+
+  InstancedRenderable::InstancedRenderable(unsigned int renderMode, std::shared_ptr<Mesh> mesh,
+                                           int count, UploadMode uploadMode, InstanceLayout layout)
+      : m_mesh(std::move(mesh)), m_ibo(0), m_nInstances(count), m_renderMode(renderMode),
+        m_uploadMode(uploadMode), m_layout(layout), m_instanceSize(getLayoutSize(layout)),
+        m_mappedData(nullptr), m_writeData(nullptr), m_region(0), m_fences() {
     static uint32_t _id = 0;
     m_instanceId        = _id++;
 
-    const auto &vertices = renderData.vertices;
-    const auto &indices  = renderData.indices;
-    m_nVertices          = static_cast<int>(vertices.size());
-    m_nIndices           = static_cast<int>(indices.size());
-
     // Bind vertex array objects for all instances
     glGenVertexArrays(1, &m_vao);
-    glBindVertexArray(m_vao);
-
-    // Bind vertex data buffer
-    glGenBuffers(1, &m_vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
-    glBufferData(GL_ARRAY_BUFFER, m_nVertices * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+    GLState::bindVertexArray(m_vao);
 
+    // Bind shared mesh vertex data buffer
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_mesh->getVbo());
     glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, m_vertexStride, GL_FLOAT, GL_FALSE, 0, (void *)0);
-
-    // Bind index data buffer
-    if (m_nIndices > 0) {
-      glGenBuffers(1, &m_ebo);
-      glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ebo);
-      glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_nIndices * sizeof(unsigned int), indices.data(),
-                   GL_STATIC_DRAW);
-    }
+    glVertexAttribPointer(0, m_mesh->getVertexStride(), GL_FLOAT, GL_FALSE, 0, (void *)0);
 
-    // Bind instance data buffer
-    glGenBuffers(1, &m_ibo);
-    glBindBuffer(GL_ARRAY_BUFFER, m_ibo);
-    glBufferData(GL_ARRAY_BUFFER, m_nInstances * sizeof(InstanceData), NULL, GL_DYNAMIC_DRAW);
-
-    // Instance models
-    for (unsigned int i = 1; i < 5; ++i) {
-      glEnableVertexAttribArray(i);
-      glVertexAttribDivisor(i, 1);
-      glVertexAttribPointer(i, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData),
-                            (void *)((i - 1) * sizeof(glm::vec4)));
-    }
+    // Bind shared mesh index data buffer
+    if (m_mesh->getNumIndices() > 0)
+      GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_mesh->getEbo());
 
-    // Instance colors
-    glEnableVertexAttribArray(5);
-    glVertexAttribDivisor(5, 1);
-    glVertexAttribPointer(5, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(InstanceData),
-                          (void *)(sizeof(glm::mat4)));
+    setupInstanceAttributes(m_vao);
+
+    // Bind instance data buffer
+    allocateInstanceDataBuffer();
   }
 
   InstancedRenderable::~InstancedRenderable() {
-    // Delete all buffer and vertex data
-    glDeleteVertexArrays(1, &m_vao);
-    glDeleteBuffers(1, &m_vbo);
-    glDeleteBuffers(1, &m_ebo);
-    glDeleteBuffers(1, &m_ibo);
+    // Delete instance buffer and vertex array, mesh data is owned by the shared mesh
+    releaseInstanceDataBuffer();
+    GLState::deleteVertexArray(m_vao);
   }
 
+  /**
+   * @brief Writes instance data at the given index. With persistent uploads, this writes straight
+   * into the region returned by the last call to beginInstanceDataUpdate().
+   */
   void InstancedRenderable::setInstanceData(size_t index, const InstanceData &data) {
-    m_instanceData[index] = data;
+    reinterpret_cast<InstanceData *>(m_writeData)[index] = data;
+  }
+
+  /** @brief Writes compact 2D instance data at the given index, see setInstanceData() */
+  void InstancedRenderable::setInstanceData(size_t index, const InstanceData2D &data) {
+    reinterpret_cast<InstanceData2D *>(m_writeData)[index] = data;
+  }
+
+  /** @brief Writes half-float compact 2D instance data at the given index, see setInstanceData() */
+  void InstancedRenderable::setInstanceData(size_t index, const InstanceData2DHalf &data) {
+    reinterpret_cast<InstanceData2DHalf *>(m_writeData)[index] = data;
   }
 
+  /**
+   * @brief Resizes the instance data buffer, preserving existing instance data up to the new size
+   * @param newSize Number of instances the buffer can hold
+   */
   void InstancedRenderable::resizeInstanceDataBuffer(size_t newSize) {
-    m_instanceData.resize(newSize);
-    glBufferData(GL_ARRAY_BUFFER, m_nInstances * sizeof(InstanceData), NULL, GL_DYNAMIC_DRAW);
+    if (m_uploadMode == UploadMode::STAGED) {
+      m_nInstances = static_cast<int>(newSize);
+      m_instanceData.resize(newSize * m_instanceSize);
+      m_writeData = m_instanceData.data();
+      glNamedBufferData(m_ibo, m_nInstances * m_instanceSize, NULL, GL_DYNAMIC_DRAW);
+      return;
+    }
+
+    // Immutable storage cannot be resized, so keep a copy of the region currently written to and
+    // recreate the buffer
+    size_t nPreserved = std::min(newSize, static_cast<size_t>(m_nInstances));
+    std::vector<std::byte> preserved(m_writeData, m_writeData + nPreserved * m_instanceSize);
+
+    releaseInstanceDataBuffer();
+    m_nInstances = static_cast<int>(newSize);
+    allocateInstanceDataBuffer();
+    std::copy(preserved.begin(), preserved.end(), m_writeData);
   }
 
+  /**
+   * @brief Makes instance data written since the last update visible to the GPU. Persistent
+   * mappings are coherent, so this only needs to upload staged data.
+   */
   void InstancedRenderable::updateInstanceDataBuffer() const {
-    glNamedBufferSubData(m_ibo, 0, m_nInstances * sizeof(InstanceData), m_instanceData.data());
+    updateInstanceDataBuffer(m_nInstances);
+  }
+
+  /**
+   * @brief Uploads only the first count instances of the instance data to the GPU
+   * @param count Number of instances to upload, clamped to the buffer size
+   */
+  void InstancedRenderable::updateInstanceDataBuffer(size_t count) const {
+    updateInstanceDataBuffer(0, count);
+  }
+
+  /**
+   * @brief Uploads a range of the instance data to the GPU, leaving all other instances as they
+   * were last uploaded
+   * @param offset Index of the first instance to upload
+   * @param count Number of instances to upload, clamped to the buffer size
+   */
+  void InstancedRenderable::updateInstanceDataBuffer(size_t offset, size_t count) const {
+    if (m_uploadMode == UploadMode::PERSISTENT || offset >= static_cast<size_t>(m_nInstances))
+      return;
+
+    count = std::min(count, m_nInstances - offset);
+    glNamedBufferSubData(m_ibo, offset * m_instanceSize, count * m_instanceSize,
+                         m_instanceData.data() + offset * m_instanceSize);
+  }
+
+  /**
+   * @brief Starts writing a new frame of instance data. With persistent uploads, this fences the
+   * region used by the previous frame, moves on to the next region and waits until the GPU has
+   * finished reading from it.
+   * @return Pointer to where instance data for this frame should be written
+   */
+  std::byte *InstancedRenderable::beginRegionUpdate() {
+    if (m_uploadMode == UploadMode::STAGED)
+      return m_writeData;
+
+    // Draws issued since the last update read from the current region
+    if (m_fences[m_region])
+      glDeleteSync(m_fences[m_region]);
+    m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    m_region = (m_region + 1) % N_BUFFERED_FRAMES;
+    waitForRegion(m_region);
+
+    size_t offset = m_region * m_nInstances * m_instanceSize;
+    m_writeData   = m_mappedData + offset;
+    glVertexArrayVertexBuffer(m_vao, INSTANCE_BINDING, m_ibo, offset,
+                              static_cast<int>(m_instanceSize));
+    return m_writeData;
+  }
+
+  /**
+   * @brief Obtains the index of the first instance written by the current update within the
+   * instance data buffer. Only persistent uploads write to regions past the start of the buffer.
+   */
+  size_t InstancedRenderable::getRegionOffset() const {
+    return m_uploadMode == UploadMode::PERSISTENT ? m_region * m_nInstances : 0;
+  }
+
+  /**
+   * @brief Creates a new vertex array drawing this renderable's mesh with instance data read from
+   * another buffer, which must use the same instance layout. The caller owns the vertex array.
+   * @param instanceBuffer The buffer to read instance data from
+   * @return Id of the new vertex array
+   */
+  unsigned int InstancedRenderable::createVertexArray(unsigned int instanceBuffer) const {
+    unsigned int vao = 0;
+    glCreateVertexArrays(1, &vao);
+
+    // Shared mesh data uses binding 0, like the attribute pointer set up for the main vertex array
+    int vertexStride = m_mesh->getVertexStride();
+    glVertexArrayVertexBuffer(vao, 0, m_mesh->getVbo(), 0,
+                              static_cast<int>(vertexStride * sizeof(float)));
+    glEnableVertexArrayAttrib(vao, 0);
+    glVertexArrayAttribFormat(vao, 0, vertexStride, GL_FLOAT, GL_FALSE, 0);
+    glVertexArrayAttribBinding(vao, 0, 0);
+    if (m_mesh->getNumIndices() > 0)
+      glVertexArrayElementBuffer(vao, m_mesh->getEbo());
+
+    setupInstanceAttributes(vao);
+    glVertexArrayVertexBuffer(vao, INSTANCE_BINDING, instanceBuffer, 0,
+                              static_cast<int>(m_instanceSize));
+    return vao;
+  }
+
+  /** @brief Obtains the number of bytes used per instance by the given layout */
+  size_t InstancedRenderable::getLayoutSize(InstanceLayout layout) {
+    switch (layout) {
+    case InstanceLayout::COMPACT_2D:
+      return sizeof(InstanceData2D);
+    case InstanceLayout::COMPACT_2D_HALF:
+      return sizeof(InstanceData2DHalf);
+    default:
+      return sizeof(InstanceData);
+    }
+  }
+
+  /**
+   * @brief Describes the instance data layout to the vertex array. Full layouts feed a model
+   * matrix to attributes 1-4, compact layouts feed position, scale and rotation to attributes 1-3.
+   * Colors always use attribute 5.
+   */
+  void InstancedRenderable::setupInstanceAttributes(unsigned int vao) const {
+    auto addAttribute = [&](unsigned int index, int size, GLenum type, size_t offset) {
+      glEnableVertexArrayAttrib(vao, index);
+      glVertexArrayAttribFormat(vao, index, size, type, GL_FALSE,
+                                static_cast<unsigned int>(offset));
+      glVertexArrayAttribBinding(vao, index, INSTANCE_BINDING);
+    };
+
+    size_t colorOffset = 0;
+    switch (m_layout) {
+    case InstanceLayout::MAT4:
+      for (unsigned int i = 1; i < 5; ++i)
+        addAttribute(i, 4, GL_FLOAT, (i - 1) * sizeof(glm::vec4));
+      colorOffset = offsetof(InstanceData, color);
+      break;
+    case InstanceLayout::COMPACT_2D:
+      addAttribute(1, 2, GL_FLOAT, offsetof(InstanceData2D, position));
+      addAttribute(2, 2, GL_FLOAT, offsetof(InstanceData2D, scale));
+      addAttribute(3, 1, GL_FLOAT, offsetof(InstanceData2D, rotation));
+      colorOffset = offsetof(InstanceData2D, color);
+      break;
+    case InstanceLayout::COMPACT_2D_HALF:
+      addAttribute(1, 2, GL_FLOAT, offsetof(InstanceData2DHalf, position));
+      addAttribute(2, 2, GL_HALF_FLOAT, offsetof(InstanceData2DHalf, scale));
+      colorOffset = offsetof(InstanceData2DHalf, color);
+      break;
+    }
+
+    // Instance colors
+    glEnableVertexArrayAttrib(vao, 5);
+    glVertexArrayAttribFormat(vao, 5, 4, GL_UNSIGNED_BYTE, GL_TRUE,
+                              static_cast<unsigned int>(colorOffset));
+    glVertexArrayAttribBinding(vao, 5, INSTANCE_BINDING);
+    glVertexArrayBindingDivisor(vao, INSTANCE_BINDING, 1);
+  }
+
+  void InstancedRenderable::allocateInstanceDataBuffer() {
+    glCreateBuffers(1, &m_ibo);
+
+    if (m_uploadMode == UploadMode::STAGED) {
+      m_instanceData.resize(m_nInstances * m_instanceSize);
+      m_writeData = m_instanceData.data();
+      glNamedBufferData(m_ibo, m_nInstances * m_instanceSize, NULL, GL_DYNAMIC_DRAW);
+    } else {
+      // Allocate one region per frame in flight and keep the whole buffer mapped
+      GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+      size_t size      = N_BUFFERED_FRAMES * m_nInstances * m_instanceSize;
+      glNamedBufferStorage(m_ibo, size, NULL, flags);
+
+      m_region     = 0;
+      m_mappedData = static_cast<std::byte *>(glMapNamedBufferRange(m_ibo, 0, size, flags));
+      m_writeData  = m_mappedData;
+
+      if (!m_mappedData) {
+        Logger::error("[InstancedRenderable] Could not map instance data buffer, falling back to "
+                      "staged uploads.");
+        GLState::deleteBuffer(m_ibo);
+        m_uploadMode = UploadMode::STAGED;
+        allocateInstanceDataBuffer();
+        return;
+      }
+    }
+
+    glVertexArrayVertexBuffer(m_vao, INSTANCE_BINDING, m_ibo, 0, static_cast<int>(m_instanceSize));
+  }
+
+  void InstancedRenderable::releaseInstanceDataBuffer() {
+    for (auto &fence : m_fences) {
+      if (fence)
+        glDeleteSync(fence);
+      fence = nullptr;
+    }
+
+    if (m_mappedData)
+      glUnmapNamedBuffer(m_ibo);
+    m_mappedData = nullptr;
+    m_writeData  = nullptr;
+
+    GLState::deleteBuffer(m_ibo);
+    m_ibo = 0;
+  }
+
+  void InstancedRenderable::waitForRegion(int region) {
+    GLsync &fence = m_fences[region];
+    if (!fence)
+      return;
+
+    GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    while (result == GL_TIMEOUT_EXPIRED)
+      result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT);
+
+    if (result == GL_WAIT_FAILED)
+      Logger::warn("[InstancedRenderable] Failed waiting for instance data region {}.", region);
+
+    glDeleteSync(fence);
+    fence = nullptr;
+  }
+
+  /**
+   * @brief Adds an entity to this instance set. Members are kept in a dense list so that render
+   * systems only visit the entities belonging to this set. Once a member was added, the set is
+   * drawn from its members only, so an emptied set draws nothing.
+   * @param entity The entity to add
+   */
+  void InstancedRenderable::addInstance(entt::entity entity) {
+    m_tracksInstances = true;
+    if (hasInstance(entity))
+      return;
+
+    m_instanceIndices[entity] = m_instances.size();
+    m_instances.push_back(entity);
+    ++m_membershipVersion;
+  }
+
+  /**
+   * @brief Removes an entity from this instance set
+   * @param entity The entity to remove
+   */
+  void InstancedRenderable::removeInstance(entt::entity entity) {
+    auto it = m_instanceIndices.find(entity);
+    if (it == m_instanceIndices.end())
+      return;
+
+    // Swap with the last member to keep the list dense
+    size_t index            = it->second;
+    entt::entity last       = m_instances.back();
+    m_instances[index]      = last;
+    m_instanceIndices[last] = index;
+    m_instances.pop_back();
+    m_instanceIndices.erase(entity);
+    ++m_membershipVersion;
+  }
+
+  /** @brief Determines if an entity is a member of this instance set */
+  bool InstancedRenderable::hasInstance(entt::entity entity) const {
+    return m_instanceIndices.contains(entity);
+  }
+
+  /**
+   * @brief Obtains the instanced renderable with the given instance id from a registry connected
+   * with connectInstanceTags()
+   * @return Pointer to the renderable if found, nullptr otherwise
+   */
+  InstancedRenderable *InstancedRenderable::find(entt::registry &registry, uint32_t instanceId) {
+    auto *sets = registry.ctx().find<InstanceSets>();
+    if (!sets)
+      return nullptr;
+
+    auto it = sets->owners.find(instanceId);
+    return it != sets->owners.end() ? registry.try_get<InstancedRenderable>(it->second) : nullptr;
+  }
+
+  /**
+   * @brief Keeps instance set membership in sync with InstanceTag components added to, changed or
+   * removed from the given registry. Instance sets and their members are tracked per registry in
+   * its context. An instanced renderable must exist before tags referencing its id are added.
+   * @param registry The registry to listen to
+   */
+  void InstancedRenderable::connectInstanceTags(entt::registry &registry) {
+    registry.ctx().emplace<InstanceSets>();
+    registry.on_construct<InstancedRenderable>()
+        .connect<&InstancedRenderable::onRenderableConstruct>();
+    registry.on_destroy<InstancedRenderable>().connect<&InstancedRenderable::onRenderableDestroy>();
+    registry.on_construct<InstanceTag>().connect<&InstancedRenderable::onInstanceTagConstruct>();
+    registry.on_update<InstanceTag>().connect<&InstancedRenderable::onInstanceTagUpdate>();
+    registry.on_destroy<InstanceTag>().connect<&InstancedRenderable::onInstanceTagDestroy>();
+  }
+
+  void InstancedRenderable::onRenderableConstruct(entt::registry &registry, entt::entity entity) {
+    uint32_t instanceId = registry.get<InstancedRenderable>(entity).getInstanceId();
+    registry.ctx().get<InstanceSets>().owners[instanceId] = entity;
+  }
+
+  void InstancedRenderable::onRenderableDestroy(entt::registry &registry, entt::entity entity) {
+    uint32_t instanceId = registry.get<InstancedRenderable>(entity).getInstanceId();
+    registry.ctx().get<InstanceSets>().owners.erase(instanceId);
+  }
+
+  void InstancedRenderable::onInstanceTagConstruct(entt::registry &registry, entt::entity entity) {
+    uint32_t instanceId = registry.get<InstanceTag>(entity).value;
+    registry.ctx().get<InstanceSets>().memberships[entity] = instanceId;
+
+    if (auto *renderable = find(registry, instanceId))
+      renderable->addInstance(entity);
+  }
+
+  void InstancedRenderable::onInstanceTagUpdate(entt::registry &registry, entt::entity entity) {
+    // Previous tag value is already overwritten, so the old set comes from the recorded membership
+    auto &memberships = registry.ctx().get<InstanceSets>().memberships;
+    if (auto it = memberships.find(entity); it != memberships.end()) {
+      if (auto *renderable = find(registry, it->second))
+        renderable->removeInstance(entity);
+    }
+
+    onInstanceTagConstruct(registry, entity);
+  }
+
+  void InstancedRenderable::onInstanceTagDestroy(entt::registry &registry, entt::entity entity) {
+    registry.ctx().get<InstanceSets>().memberships.erase(entity);
+    if (auto *renderable = find(registry, registry.get<InstanceTag>(entity).value))
+      renderable->removeInstance(entity);
   }
 } // namespace TritiumEngine::Rendering
\ No newline at end of file
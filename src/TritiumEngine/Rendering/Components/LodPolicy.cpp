@@ -0,0 +1,64 @@
+#include <TritiumEngine/Rendering/Components/LodPolicy.hpp>
+
+#include <algorithm>
+
+namespace TritiumEngine::Rendering
+{
+  LodPolicy::LodPolicy(const std::string &name, int nLevels, float targetFrameMs,
+                       int initialLevel)
+      : m_name(name), m_nLevels(std::max(nLevels, 1)), m_targetFrameMs(targetFrameMs),
+        m_level(std::clamp(initialLevel, 0, m_nLevels - 1)), m_previousLevel(m_level),
+        m_averageFrameMs(targetFrameMs) {}
+
+  /**
+   * @brief Adds the time the latest frame took and steps the level of detail once the average
+   * frame time has been over or under budget for long enough. Refining back into a level that was
+   * just too expensive waits twice as long every time it happens, so levels don't oscillate.
+   * Stalls such as the first frame after a scene load are ignored or capped, see LodPolicy.
+   * @param frameMs Duration of the latest frame in milliseconds
+   * @param dt Time passed since the last call in seconds
+   * @return True if the level changed
+   */
+  bool LodPolicy::addFrameTime(float frameMs, float dt) {
+    if (m_nWarmupFrames > 0) {
+      --m_nWarmupFrames;
+      return false;
+    }
+
+    // Outliers count as a slow frame but not as seconds spent over budget
+    frameMs = std::min(frameMs, m_targetFrameMs * MAX_FRAME_TIME_FACTOR);
+    dt      = std::min(dt, frameMs / 1000.f);
+
+    m_averageFrameMs += (frameMs - m_averageFrameMs) * smoothing;
+
+    // Track how long the frame time has stayed outside the band around the target
+    float band         = m_targetFrameMs * hysteresis;
+    bool isOverBudget  = m_averageFrameMs > m_targetFrameMs + band;
+    bool isUnderBudget = m_averageFrameMs < m_targetFrameMs - band;
+    m_overBudgetTime   = isOverBudget ? m_overBudgetTime + dt : 0.f;
+    m_underBudgetTime  = isUnderBudget ? m_underBudgetTime + dt : 0.f;
+
+    int level = m_level;
+    if (m_overBudgetTime >= settleTime)
+      level = std::min(m_level + 1, m_nLevels - 1);
+    else if (m_underBudgetTime >= settleTime * m_refineBackoff)
+      level = std::max(m_level - 1, 0);
+
+    if (level == m_level)
+      return false;
+
+    // Undoing the latest refinement means the finer level can't be held
+    bool isCoarser  = level > m_level;
+    m_refineBackoff = isCoarser && level == m_previousLevel
+                          ? std::min(m_refineBackoff * 2.f, MAX_REFINE_BACKOFF)
+                          : m_refineBackoff;
+
+    // Give the new level a full settle time before judging it
+    m_previousLevel   = m_level;
+    m_level           = level;
+    m_overBudgetTime  = 0.f;
+    m_underBudgetTime = 0.f;
+    ++m_nTransitions;
+    return true;
+  }
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
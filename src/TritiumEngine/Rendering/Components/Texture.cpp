@@ -1,4 +1,5 @@
 #include <TritiumEngine/Rendering/Components/Texture.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
 
 #include <GL/glew.h>
 
@@ -8,18 +9,20 @@ namespace TritiumEngine::Rendering
                    unsigned int format, unsigned int type, const void *data)
       : m_target(target) {
     glGenTextures(1, &m_id);
-    glBindTexture(m_target, m_id);
+    GLState::bindTexture(m_target, m_id);
     glTexImage2D(m_target, 0, internalFormat, width, height, 0, format, type, data);
-    glBindTexture(m_target, 0);
+    GLState::bindTexture(m_target, 0);
   }
 
-  Texture::~Texture() { glDeleteTextures(1, &m_id); }
+  Texture::~Texture() { GLState::deleteTexture(m_id); }
 
-  void Texture::bind() const { glBindTexture(m_target, m_id); }
+  void Texture::bind() const { GLState::bindTexture(m_target, m_id); }
 
-  void Texture::unbind() const { glBindTexture(m_target, 0); }
+  void Texture::unbind() const { GLState::bindTexture(m_target, 0); }
 
-  void Texture::selectActiveUnit(unsigned int unit) const { glActiveTexture(GL_TEXTURE0 + unit); }
+  void Texture::selectActiveUnit(unsigned int unit) const {
+    GLState::activeTexture(GL_TEXTURE0 + unit);
+  }
 
   void Texture::setParameter(unsigned int param, int value) const {
     glTexParameteri(m_target, param, value);
@@ -0,0 +1,112 @@
+#include <TritiumEngine/Rendering/DensityImpostor.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
+#include <TritiumEngine/Utilities/ColorUtils.hpp>
+
+#include <GL/glew.h>
+
+#include <algorithm>
+
+using namespace TritiumEngine::Utilities;
+
+namespace TritiumEngine::Rendering
+{
+  DensityImpostor::DensityImpostor(ShaderManager &shaderManager)
+      : m_shaderManager(shaderManager), m_shader(shaderManager.get("screen")), m_size(0),
+        m_quadVao(0), m_quadVbo(0) {
+    // Vertex attributes for a quad that fills the entire camera in Normalized Device Coordinates
+    float quadData[] = {
+        // positions  // texCoords
+        -1.f, 1.f,    0.f, 1.f, // T1 - 1
+        -1.f, -1.f,   0.f, 0.f, // T1 - 2
+        1.f,  -1.f,   1.f, 0.f, // T1 - 3
+        -1.f, 1.f,    0.f, 1.f, // T2 - 1
+        1.f,  -1.f,   1.f, 0.f, // T2 - 2
+        1.f,  1.f,    1.f, 1.f  // T2 - 3
+    };
+
+    glCreateBuffers(1, &m_quadVbo);
+    glNamedBufferStorage(m_quadVbo, sizeof(quadData), quadData, 0);
+
+    glCreateVertexArrays(1, &m_quadVao);
+    glVertexArrayVertexBuffer(m_quadVao, 0, m_quadVbo, 0, 4 * sizeof(float));
+    glEnableVertexArrayAttrib(m_quadVao, 0);
+    glVertexArrayAttribFormat(m_quadVao, 0, 2, GL_FLOAT, GL_FALSE, 0);
+    glVertexArrayAttribBinding(m_quadVao, 0, 0);
+    glEnableVertexArrayAttrib(m_quadVao, 1);
+    glVertexArrayAttribFormat(m_quadVao, 1, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float));
+    glVertexArrayAttribBinding(m_quadVao, 1, 0);
+  }
+
+  DensityImpostor::~DensityImpostor() {
+    GLState::deleteVertexArray(m_quadVao);
+    GLState::deleteBuffer(m_quadVbo);
+  }
+
+  /**
+   * @brief Sets the resolution of the impostor texture, recreating it if the size changed
+   * @param width Number of texels horizontally
+   * @param height Number of texels vertically
+   */
+  void DensityImpostor::resize(int width, int height) {
+    glm::ivec2 size = glm::max(glm::ivec2(width, height), 1);
+    if (size == m_size)
+      return;
+
+    m_size = size;
+    m_accumulation.resize(static_cast<size_t>(m_size.x) * m_size.y);
+    m_pixels.resize(m_accumulation.size());
+
+    // Linear filtering blends neighbouring texels, hiding the low resolution when magnified
+    m_texture = std::make_unique<Texture>(m_size.x, m_size.y, GL_TEXTURE_2D, GL_RGBA8, GL_RGBA,
+                                          GL_UNSIGNED_BYTE);
+    m_texture->bind();
+    m_texture->setParameter(GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    m_texture->setParameter(GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    m_texture->setParameter(GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    m_texture->setParameter(GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    m_texture->unbind();
+  }
+
+  /** @brief Removes all splatted instances */
+  void DensityImpostor::clear() {
+    std::fill(m_accumulation.begin(), m_accumulation.end(), glm::vec4(0.f));
+  }
+
+  /**
+   * @brief Resolves the splatted instances to the average color of each texel, with the covered
+   * fraction of the texel as alpha, and uploads them to the texture
+   * @param texelArea Area covered by a single texel, in the units of the splatted areas
+   */
+  void DensityImpostor::upload(float texelArea) {
+    for (size_t i = 0; i < m_accumulation.size(); ++i) {
+      const glm::vec4 &texel = m_accumulation[i];
+      if (texel.a <= 0.f) {
+        m_pixels[i] = 0;
+        continue;
+      }
+
+      glm::vec3 color = glm::vec3(texel) / texel.a;
+      float coverage  = std::min(texel.a / texelArea, 1.f);
+      m_pixels[i]     = ColorUtils::FromRGBAComponents(static_cast<uint8_t>(color.r),
+                                                       static_cast<uint8_t>(color.g),
+                                                       static_cast<uint8_t>(color.b),
+                                                       static_cast<uint8_t>(coverage * 255.f))
+                        .value;
+    }
+
+    glTextureSubImage2D(m_texture->getId(), 0, 0, 0, m_size.x, m_size.y, GL_RGBA,
+                        GL_UNSIGNED_BYTE, m_pixels.data());
+  }
+
+  /** @brief Draws the impostor texture over the whole camera */
+  void DensityImpostor::draw() const {
+    if (!m_texture)
+      return;
+
+    m_shaderManager.use(m_shader);
+    GLState::bindVertexArray(m_quadVao);
+    GLState::activeTexture(GL_TEXTURE0);
+    m_texture->bind();
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+  }
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
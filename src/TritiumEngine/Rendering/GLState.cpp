@@ -0,0 +1,149 @@
+#include <TritiumEngine/Rendering/GLState.hpp>
+
+#include <GL/glew.h>
+
+namespace TritiumEngine::Rendering
+{
+  void GLState::setDepthTest(bool enable) {
+    if (shouldChange(s_depthTest, enable))
+      enable ? glEnable(GL_DEPTH_TEST) : glDisable(GL_DEPTH_TEST);
+  }
+
+  void GLState::setDepthFunc(unsigned int func) {
+    if (shouldChange(s_depthFunc, func))
+      glDepthFunc(func);
+  }
+
+  void GLState::setBlend(bool enable) {
+    if (shouldChange(s_blend, enable))
+      enable ? glEnable(GL_BLEND) : glDisable(GL_BLEND);
+  }
+
+  void GLState::setBlendFunc(unsigned int sFactor, unsigned int dFactor) {
+    if (s_blendSFactor == sFactor && s_blendDFactor == dFactor) {
+      ++s_avoidedChanges;
+      return;
+    }
+
+    s_blendSFactor = sFactor;
+    s_blendDFactor = dFactor;
+    ++s_appliedChanges;
+    glBlendFunc(sFactor, dFactor);
+  }
+
+  void GLState::useProgram(unsigned int program) {
+    if (shouldChange(s_program, program))
+      glUseProgram(program);
+  }
+
+  void GLState::bindVertexArray(unsigned int vao) {
+    if (shouldChange(s_vao, vao))
+      glBindVertexArray(vao);
+  }
+
+  /**
+   * @brief Binds a buffer to a target. Element array buffer bindings are part of the vertex array
+   * state, so they are always passed through.
+   */
+  void GLState::bindBuffer(unsigned int target, unsigned int buffer) {
+    if (target == GL_ELEMENT_ARRAY_BUFFER) {
+      glBindBuffer(target, buffer);
+      return;
+    }
+
+    auto [it, inserted] = s_buffers.try_emplace(target, UNKNOWN);
+    if (shouldChange(it->second, buffer))
+      glBindBuffer(target, buffer);
+  }
+
+  /** @brief Binds a buffer to an indexed binding point, which also binds it to the target */
+  void GLState::bindBufferBase(unsigned int target, unsigned int index, unsigned int buffer) {
+    auto [it, inserted] = s_indexedBuffers.try_emplace(makeKey(target, index), UNKNOWN);
+    if (shouldChange(it->second, buffer)) {
+      glBindBufferBase(target, index, buffer);
+      s_buffers[target] = buffer;
+    }
+  }
+
+  void GLState::activeTexture(unsigned int unit) {
+    if (shouldChange(s_activeUnit, unit))
+      glActiveTexture(unit);
+  }
+
+  /** @brief Binds a texture to a target of the currently active texture unit */
+  void GLState::bindTexture(unsigned int target, unsigned int texture) {
+    if (s_activeUnit == UNKNOWN)
+      activeTexture(GL_TEXTURE0);
+
+    auto [it, inserted] = s_textures.try_emplace(makeKey(s_activeUnit, target), UNKNOWN);
+    if (shouldChange(it->second, texture))
+      glBindTexture(target, texture);
+  }
+
+  // Deleting objects implicitly unbinds them from the current context
+  void GLState::deleteProgram(unsigned int program) {
+    glDeleteProgram(program);
+    if (s_program == program)
+      s_program = UNKNOWN;
+  }
+
+  void GLState::deleteVertexArray(unsigned int vao) {
+    glDeleteVertexArrays(1, &vao);
+    if (s_vao == vao)
+      s_vao = 0;
+  }
+
+  void GLState::deleteBuffer(unsigned int buffer) {
+    glDeleteBuffers(1, &buffer);
+    for (auto &[target, bound] : s_buffers) {
+      if (bound == buffer)
+        bound = 0;
+    }
+    for (auto &[key, bound] : s_indexedBuffers) {
+      if (bound == buffer)
+        bound = 0;
+    }
+  }
+
+  void GLState::deleteTexture(unsigned int texture) {
+    glDeleteTextures(1, &texture);
+    for (auto &[key, bound] : s_textures) {
+      if (bound == texture)
+        bound = 0;
+    }
+  }
+
+  /** @brief Forgets all cached state, the next change of any state will always be applied */
+  void GLState::invalidate() {
+    s_depthTest    = UNKNOWN;
+    s_depthFunc    = UNKNOWN;
+    s_blend        = UNKNOWN;
+    s_blendSFactor = UNKNOWN;
+    s_blendDFactor = UNKNOWN;
+    s_program      = UNKNOWN;
+    s_vao          = UNKNOWN;
+    s_activeUnit   = UNKNOWN;
+    s_buffers.clear();
+    s_indexedBuffers.clear();
+    s_textures.clear();
+  }
+
+  /** @brief Stores the state change counters of the last frame and resets them for the next one */
+  void GLState::newFrame() {
+    s_lastAvoidedChanges = s_avoidedChanges;
+    s_lastAppliedChanges = s_appliedChanges;
+    s_avoidedChanges     = 0;
+    s_appliedChanges     = 0;
+  }
+
+  bool GLState::shouldChange(unsigned int &current, unsigned int value) {
+    if (current == value) {
+      ++s_avoidedChanges;
+      return false;
+    }
+
+    current = value;
+    ++s_appliedChanges;
+    return true;
+  }
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include <TritiumEngine/Rendering/GLState.hpp>
+#include <TritiumEngine/Rendering/GpuCuller.hpp>
+
+#include <GL/glew.h>
+
+namespace TritiumEngine::Rendering
+{
+  GpuCuller::GpuCuller(ShaderManager &shaderManager, float boundingRadius)
+      : m_shaderManager(shaderManager), m_shader(shaderManager.get("frustum_cull")),
+        m_boundingRadius(boundingRadius), m_culledBuffer(0), m_commandBuffer(0), m_vao(0),
+        m_capacity(0), m_instanceId(~0u), m_regionOffset(0) {
+    m_planesUniform         = shaderManager.getUniform<glm::vec4>(m_shader, "frustumPlanes");
+    m_firstInstanceUniform  = shaderManager.getUniform<unsigned int>(m_shader, "firstInstance");
+    m_nInstancesUniform     = shaderManager.getUniform<unsigned int>(m_shader, "nInstances");
+    m_instanceWordsUniform  = shaderManager.getUniform<unsigned int>(m_shader, "instanceWords");
+    m_instanceLayoutUniform = shaderManager.getUniform<unsigned int>(m_shader, "instanceLayout");
+    m_boundingRadiusUniform = shaderManager.getUniform<float>(m_shader, "boundingRadius");
+
+    glCreateBuffers(1, &m_commandBuffer);
+    glNamedBufferData(m_commandBuffer, sizeof(DrawCommand), NULL, GL_DYNAMIC_DRAW);
+  }
+
+  GpuCuller::~GpuCuller() {
+    releaseCulledBuffer();
+    GLState::deleteBuffer(m_commandBuffer);
+  }
+
+  /**
+   * @brief Starts culling a new frame of the renderable's instances. Resets the instance count of
+   * the draw command and extracts the frustum planes from the camera's projection view matrix,
+   * which works alike for orthographic and perspective projections.
+   * @param renderable The renderable whose current instance data is culled
+   * @param projectionView Projection view matrix of the camera to cull against
+   */
+  void GpuCuller::begin(const InstancedRenderable &renderable, const glm::mat4 &projectionView) {
+    size_t size = renderable.getNumInstances() * renderable.getInstanceSize();
+    if (size > m_capacity || renderable.getInstanceId() != m_instanceId)
+      allocateCulledBuffer(renderable);
+
+    // Indexed meshes draw indices, array draws read the same fields as vertex counts
+    bool isIndexed      = renderable.getNumIndices() > 0;
+    int nVertices       = renderable.getNumVertices() / renderable.getVertexStride();
+    int count           = isIndexed ? renderable.getNumIndices() : nVertices;
+    DrawCommand command = {static_cast<uint32_t>(count), 0, 0, 0, 0};
+    glNamedBufferSubData(m_commandBuffer, 0, sizeof(DrawCommand), &command);
+
+    // Planes of the clip space cube in world space, normalized for sphere distances
+    glm::mat4 rows      = glm::transpose(projectionView);
+    glm::vec4 planes[6] = {rows[3] + rows[0], rows[3] - rows[0], rows[3] + rows[1],
+                           rows[3] - rows[1], rows[3] + rows[2], rows[3] - rows[2]};
+    for (auto &plane : planes)
+      plane /= glm::length(glm::vec3(plane));
+
+    m_shaderManager.use(m_shader);
+    m_shaderManager.setVector4Array(m_planesUniform, planes, 6);
+    m_shaderManager.setUint(m_instanceWordsUniform,
+                            static_cast<unsigned int>(renderable.getInstanceSize() / 4));
+    m_shaderManager.setUint(m_instanceLayoutUniform,
+                            static_cast<unsigned int>(renderable.getInstanceLayout()));
+    m_shaderManager.setFloat(m_boundingRadiusUniform, m_boundingRadius);
+
+    GLState::bindBufferBase(GL_SHADER_STORAGE_BUFFER, SOURCE_BINDING,
+                            renderable.getInstanceBuffer());
+    GLState::bindBufferBase(GL_SHADER_STORAGE_BUFFER, CULLED_BINDING, m_culledBuffer);
+    GLState::bindBufferBase(GL_SHADER_STORAGE_BUFFER, COMMAND_BINDING, m_commandBuffer);
+    m_regionOffset = static_cast<uint32_t>(renderable.getRegionOffset());
+  }
+
+  /**
+   * @brief Culls a range of instances, appending the survivors to those of earlier ranges. Must be
+   * called between begin() and draw() with the culling shader still in use.
+   * @param firstInstance Index of the first instance to cull
+   * @param count Number of instances to cull
+   */
+  void GpuCuller::cull(uint32_t firstInstance, uint32_t count) {
+    if (count == 0)
+      return;
+
+    m_shaderManager.setUint(m_firstInstanceUniform, m_regionOffset + firstInstance);
+    m_shaderManager.setUint(m_nInstancesUniform, count);
+    glDispatchCompute((count + WORK_GROUP_SIZE - 1) / WORK_GROUP_SIZE, 1, 1);
+  }
+
+  /**
+   * @brief Draws the instances that survived culling with the shader currently in use. The
+   * instance count is read from the draw command on the GPU.
+   * @param renderable The renderable that was culled
+   */
+  void GpuCuller::draw(const InstancedRenderable &renderable) const {
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+
+    GLState::bindVertexArray(m_vao);
+    GLState::bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_commandBuffer);
+    if (renderable.getNumIndices() > 0)
+      glDrawElementsIndirect(renderable.getRenderMode(), GL_UNSIGNED_INT, 0);
+    else
+      glDrawArraysIndirect(renderable.getRenderMode(), 0);
+  }
+
+  /** @brief Determines if the current context supports compute shaders and indirect draws */
+  bool GpuCuller::isSupported() { return GLEW_VERSION_4_3; }
+
+  // Sizes the culled buffer to hold all instances of the renderable
+  void GpuCuller::allocateCulledBuffer(const InstancedRenderable &renderable) {
+    releaseCulledBuffer();
+
+    m_capacity   = renderable.getNumInstances() * renderable.getInstanceSize();
+    m_instanceId = renderable.getInstanceId();
+    glCreateBuffers(1, &m_culledBuffer);
+    glNamedBufferData(m_culledBuffer, m_capacity, NULL, GL_DYNAMIC_COPY);
+    m_vao = renderable.createVertexArray(m_culledBuffer);
+  }
+
+  void GpuCuller::releaseCulledBuffer() {
+    GLState::deleteVertexArray(m_vao);
+    GLState::deleteBuffer(m_culledBuffer);
+    m_vao          = 0;
+    m_culledBuffer = 0;
+    m_capacity     = 0;
+  }
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
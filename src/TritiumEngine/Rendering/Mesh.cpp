@@ -0,0 +1,123 @@
+#include <TritiumEngine/Rendering/Mesh.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
+#include <TritiumEngine/Utilities/Logger.hpp>
+
+#include <GL/glew.h>
+
+#include <string_view>
+
+using namespace TritiumEngine::Utilities;
+
+namespace TritiumEngine::Rendering
+{
+  Mesh::Mesh(const RenderData &renderData) : m_vertexStride(renderData.vertexStride), m_ebo(0) {
+    const auto &vertices = renderData.vertices;
+    const auto &indices  = renderData.indices;
+    m_nVertices          = static_cast<int>(vertices.size());
+    m_nIndices           = static_cast<int>(indices.size());
+
+    // Bind vertex array object
+    glGenVertexArrays(1, &m_vao);
+    GLState::bindVertexArray(m_vao);
+
+    // Bind vertex data buffer
+    glGenBuffers(1, &m_vbo);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    glBufferData(GL_ARRAY_BUFFER, m_nVertices * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, m_vertexStride, GL_FLOAT, GL_FALSE, 0, (void *)0);
+    glEnableVertexAttribArray(0);
+
+    // Bind index data buffer
+    if (m_nIndices > 0) {
+      glGenBuffers(1, &m_ebo);
+      GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ebo);
+      glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_nIndices * sizeof(unsigned int), indices.data(),
+                   GL_STATIC_DRAW);
+    }
+  }
+
+  Mesh::~Mesh() {
+    // Delete all buffer and vertex data
+    GLState::deleteVertexArray(m_vao);
+    GLState::deleteBuffer(m_vbo);
+    GLState::deleteBuffer(m_ebo);
+  }
+
+  /**
+   * @brief Obtains a mesh matching the given render data, uploading it to the GPU only if no mesh
+   * with identical contents is currently alive
+   * @param renderData The vertex and index data of the mesh
+   * @return Shared pointer to the mesh
+   */
+  std::shared_ptr<Mesh> Mesh::get(const RenderData &renderData) {
+    size_t hash = hashRenderData(renderData);
+
+    // Look for a live mesh with identical contents, dropping expired entries along the way
+    auto [begin, end] = s_contentCache.equal_range(hash);
+    for (auto it = begin; it != end;) {
+      if (it->second.mesh.expired()) {
+        it = s_contentCache.erase(it);
+        continue;
+      }
+
+      if (isEqual(it->second.renderData, renderData))
+        return it->second.mesh.lock();
+      ++it;
+    }
+
+    auto mesh = std::make_shared<Mesh>(renderData);
+    s_contentCache.emplace(hash, CacheEntry{renderData, mesh});
+    return mesh;
+  }
+
+  /**
+   * @brief Obtains the mesh registered under the given name, creating it from the render data if
+   * it does not exist yet
+   * @param name Unique name of the mesh
+   * @param renderData The vertex and index data used if the mesh needs creating
+   * @return Shared pointer to the mesh
+   */
+  std::shared_ptr<Mesh> Mesh::get(const std::string &name, const RenderData &renderData) {
+    auto &foundItem = s_namedCache[name];
+    if (auto mesh = foundItem.lock())
+      return mesh;
+
+    auto mesh = get(renderData);
+    foundItem = mesh;
+    return mesh;
+  }
+
+  /**
+   * @brief Tries locating a mesh registered under the given name
+   * @return Shared pointer to the mesh if found, nullptr otherwise
+   */
+  std::shared_ptr<Mesh> Mesh::find(const std::string &name) {
+    auto it = s_namedCache.find(name);
+    if (it == s_namedCache.end() || it->second.expired()) {
+      Logger::warn("[Mesh] No mesh named '{}' found!", name);
+      return nullptr;
+    }
+
+    return it->second.lock();
+  }
+
+  size_t Mesh::hashRenderData(const RenderData &renderData) {
+    const auto &vertices = renderData.vertices;
+    const auto &indices  = renderData.indices;
+
+    std::hash<std::string_view> hasher;
+    size_t vertexHash = hasher({reinterpret_cast<const char *>(vertices.data()),
+                                vertices.size() * sizeof(float)});
+    size_t indexHash  = hasher({reinterpret_cast<const char *>(indices.data()),
+                                indices.size() * sizeof(unsigned int)});
+
+    size_t hash = std::hash<int>{}(renderData.vertexStride);
+    hash ^= vertexHash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= indexHash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+  }
+
+  bool Mesh::isEqual(const RenderData &a, const RenderData &b) {
+    return a.vertexStride == b.vertexStride && a.vertices == b.vertices && a.indices == b.indices;
+  }
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
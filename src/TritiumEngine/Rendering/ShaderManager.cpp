@@ -1,10 +1,13 @@
 #include <TritiumEngine/Core/ResourceManager.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
 #include <TritiumEngine/Rendering/ShaderCode.hpp>
 #include <TritiumEngine/Rendering/ShaderManager.hpp>
 
 #include <GL/glew.h>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
+
 using namespace TritiumEngine::Core;
 
 namespace TritiumEngine::Rendering
@@ -12,7 +15,7 @@ namespace TritiumEngine::Rendering
   ShaderManager::~ShaderManager() {
     // Delete all stored programs
     for (auto &item : m_nameToIdMap)
-      glDeleteProgram(item.second);
+      GLState::deleteProgram(item.second);
   }
 
   /**
@@ -22,28 +25,22 @@ namespace TritiumEngine::Rendering
    * @param vertexData The code string for the vertex shader program
    * @param fragmentData The code string for the fragment shader program
    * @param geometryData The code string for the geometry shader program, optional
-   * @param computeData The code string for the compute shader program, optional
    * @returns Id of the new shader program
    */
   ShaderId ShaderManager::create(const std::string &name, const std::string &vertexData,
                                  const std::string &fragmentData,
-                                 const std::string &geometryData = "",
-                                 const std::string &computeData  = "") {
+                                 const std::string &geometryData = "") {
     ShaderId programId = 0;
     // Compile vertex and fragment shaders
     ShaderId vertexId   = compile(vertexData.c_str(), GL_VERTEX_SHADER);
     ShaderId fragmentId = compile(fragmentData.c_str(), GL_FRAGMENT_SHADER);
     std::vector<ShaderId> shaderPrograms{vertexId, fragmentId};
 
-    // Additionally compile geometry and compute shaders if provided
+    // Additionally compile geometry shader if provided
     if (!geometryData.empty()) {
       ShaderId geometryId = compile(geometryData.c_str(), GL_GEOMETRY_SHADER);
       shaderPrograms.push_back(geometryId);
     }
-    if (!computeData.empty()) {
-      ShaderId computeId = compile(computeData.c_str(), GL_COMPUTE_SHADER);
-      shaderPrograms.push_back(computeId);
-    }
 
     // Link and add shader program to storage
     programId = link(shaderPrograms);
@@ -53,10 +50,28 @@ namespace TritiumEngine::Rendering
     return programId;
   }
 
+  /**
+   * @brief Creates a new compute shader program. Compute shaders can't be linked with any other
+   * stage so they make up a program on their own. Will overwrite any cached shader with the same
+   * name.
+   * @param name The name of the new shader to create
+   * @param computeData The code string for the compute shader program
+   * @returns Id of the new shader program
+   */
+  ShaderId ShaderManager::createCompute(const std::string &name, const std::string &computeData) {
+    ShaderId computeId = compile(computeData.c_str(), GL_COMPUTE_SHADER);
+    ShaderId programId = link({computeId});
+    if (programId != 0)
+      m_nameToIdMap[name] = programId;
+
+    return programId;
+  }
+
   /**
    * @brief Loads a shader from file or cache using its base name
    * @param name The base name of the shader to load. The constituent shaders are loaded using the
-   * base name + a specific extension.
+   * base name + a specific extension. A shader with a compute stage is loaded as a compute-only
+   * program.
    * @param reload If true, will force a reload of the shader files and overwrite any shader of the
    * same name
    * @returns Id of the new shader program
@@ -69,10 +84,13 @@ namespace TritiumEngine::Rendering
         return it->second;
     }
 
+    const auto &computeShader = ResourceManager<ShaderCode>::get(name + ".comp", reload, true);
+    if (computeShader != nullptr)
+      return createCompute(name, computeShader->data);
+
     const auto &vertexShader   = ResourceManager<ShaderCode>::get(name + ".vert", reload);
     const auto &fragmentShader = ResourceManager<ShaderCode>::get(name + ".frag", reload);
     const auto &geometryShader = ResourceManager<ShaderCode>::get(name + ".geom", reload, true);
-    const auto &computeShader  = ResourceManager<ShaderCode>::get(name + ".comp", reload, true);
 
     if (vertexShader == nullptr || fragmentShader == nullptr)
       return 0;
@@ -80,9 +98,8 @@ namespace TritiumEngine::Rendering
     const std::string &vertexData   = vertexShader->data;
     const std::string &fragmentData = fragmentShader->data;
     const std::string &geometryData = geometryShader ? geometryShader->data : "";
-    const std::string &computeData  = computeShader ? computeShader->data : "";
 
-    return create(name, vertexData, fragmentData, geometryData, computeData);
+    return create(name, vertexData, fragmentData, geometryData);
   }
 
   /**
@@ -90,7 +107,7 @@ namespace TritiumEngine::Rendering
    * @param id The id of the shader program to activate
    */
   void ShaderManager::use(ShaderId id) {
-    glUseProgram(id);
+    GLState::useProgram(id);
     m_currentShaderId = id;
   }
 
@@ -104,72 +121,155 @@ namespace TritiumEngine::Rendering
     use(id);
   }
 
+  /**
+   * @brief Obtains the location of a uniform from the locations cached when the program was linked.
+   * Names reflection does not list verbatim, such as array elements or struct members, are queried
+   * from the program once and cached as well, even if the uniform is not active.
+   * @param id The id of the shader program holding the uniform
+   * @param name Name of the uniform
+   * @returns Location of the uniform, -1 if the uniform is not active in the program
+   */
+  int ShaderManager::getUniformLocation(ShaderId id, const std::string &name) const {
+    if (id == 0)
+      return -1;
+
+    auto &locations = m_uniformLocations[id];
+    auto it         = locations.find(name);
+    if (it != locations.end())
+      return it->second;
+
+    int location = glGetUniformLocation(id, name.c_str());
+    locations.emplace(name, location);
+    return location;
+  }
+
+  /**
+   * @brief Assigns a fixed binding point to a uniform block for all current and future shader
+   * programs declaring it
+   * @param blockName Name of the uniform block
+   * @param binding The binding point to read the uniform block from
+   */
+  void ShaderManager::setUniformBlockBinding(const std::string &blockName, unsigned int binding) {
+    m_uniformBlockBindings[blockName] = binding;
+    for (auto &item : m_nameToIdMap)
+      bindUniformBlocks(item.second);
+  }
+
   void ShaderManager::setBool(const std::string &name, bool value) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniform1i(uniformLocation, value);
   }
 
   void ShaderManager::setInt(const std::string &name, int value) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniform1i(uniformLocation, value);
   }
 
   void ShaderManager::setUint(const std::string &name, unsigned int value) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniform1ui(uniformLocation, value);
   }
 
   void ShaderManager::setFloat(const std::string &name, float value) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniform1f(uniformLocation, value);
   }
 
   void ShaderManager::setVector2(const std::string &name, const glm::vec2 &value) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniform2fv(uniformLocation, 1, glm::value_ptr(value));
   }
 
   void ShaderManager::setVector2(const std::string &name, float x, float y) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniform2f(uniformLocation, x, y);
   }
 
   void ShaderManager::setVector3(const std::string &name, const glm::vec3 &value) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniform3fv(uniformLocation, 1, glm::value_ptr(value));
   }
 
   void ShaderManager::setVector3(const std::string &name, float x, float y, float z) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniform3f(uniformLocation, x, y, z);
   }
 
   void ShaderManager::setVector4(const std::string &name, const glm::vec4 &value) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniform4fv(uniformLocation, 1, glm::value_ptr(value));
   }
 
   void ShaderManager::setVector4(const std::string &name, float x, float y, float z,
                                  float w) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniform4f(uniformLocation, x, y, z, w);
   }
 
   void ShaderManager::setMatrix2(const std::string &name, const glm::mat2 &value) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniformMatrix2fv(uniformLocation, 1, GL_FALSE, glm::value_ptr(value));
   }
 
   void ShaderManager::setMatrix3(const std::string &name, const glm::mat3 &value) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniformMatrix3fv(uniformLocation, 1, GL_FALSE, glm::value_ptr(value));
   }
 
   void ShaderManager::setMatrix4(const std::string &name, const glm::mat4 &value) const {
-    int uniformLocation = glGetUniformLocation(m_currentShaderId, name.c_str());
+    int uniformLocation = getUniformLocation(m_currentShaderId, name);
     glUniformMatrix4fv(uniformLocation, 1, GL_FALSE, glm::value_ptr(value));
   }
 
+  void ShaderManager::setBool(Uniform<bool> uniform, bool value) const {
+    glUniform1i(uniform.location, value);
+  }
+
+  void ShaderManager::setInt(Uniform<int> uniform, int value) const {
+    glUniform1i(uniform.location, value);
+  }
+
+  void ShaderManager::setUint(Uniform<unsigned int> uniform, unsigned int value) const {
+    glUniform1ui(uniform.location, value);
+  }
+
+  void ShaderManager::setFloat(Uniform<float> uniform, float value) const {
+    glUniform1f(uniform.location, value);
+  }
+
+  void ShaderManager::setVector2(Uniform<glm::vec2> uniform, const glm::vec2 &value) const {
+    glUniform2fv(uniform.location, 1, glm::value_ptr(value));
+  }
+
+  void ShaderManager::setVector3(Uniform<glm::vec3> uniform, const glm::vec3 &value) const {
+    glUniform3fv(uniform.location, 1, glm::value_ptr(value));
+  }
+
+  void ShaderManager::setVector4(Uniform<glm::vec4> uniform, const glm::vec4 &value) const {
+    glUniform4fv(uniform.location, 1, glm::value_ptr(value));
+  }
+
+  void ShaderManager::setMatrix2(Uniform<glm::mat2> uniform, const glm::mat2 &value) const {
+    glUniformMatrix2fv(uniform.location, 1, GL_FALSE, glm::value_ptr(value));
+  }
+
+  void ShaderManager::setMatrix3(Uniform<glm::mat3> uniform, const glm::mat3 &value) const {
+    glUniformMatrix3fv(uniform.location, 1, GL_FALSE, glm::value_ptr(value));
+  }
+
+  void ShaderManager::setMatrix4(Uniform<glm::mat4> uniform, const glm::mat4 &value) const {
+    glUniformMatrix4fv(uniform.location, 1, GL_FALSE, glm::value_ptr(value));
+  }
+
+  /**
+   * @brief Sets consecutive elements of a uniform array, starting at the element the uniform
+   * refers to
+   */
+  void ShaderManager::setVector4Array(Uniform<glm::vec4> uniform, const glm::vec4 *values,
+                                      int count) const {
+    glUniform4fv(uniform.location, count, glm::value_ptr(values[0]));
+  }
+
   // Compiles shader from code, returning its program ID
   ShaderId ShaderManager::compile(const char *shaderCode, unsigned int shaderType) {
     ShaderId shaderId = glCreateShader(shaderType);
@@ -210,6 +310,48 @@ namespace TritiumEngine::Rendering
       Logger::error("An error occurred while linking shader:\n{}", errorLog);
     }
 
+    reflectUniforms(program);
+    bindUniformBlocks(program);
     return program;
   }
+
+  // Binds all uniform blocks with an assigned binding point that are declared by the program
+  void ShaderManager::bindUniformBlocks(ShaderId program) const {
+    for (const auto &[blockName, binding] : m_uniformBlockBindings) {
+      unsigned int blockIndex = glGetUniformBlockIndex(program, blockName.c_str());
+      if (blockIndex != GL_INVALID_INDEX)
+        glUniformBlockBinding(program, blockIndex, binding);
+    }
+  }
+
+  // Enumerates all active uniforms of a linked program and caches their locations
+  void ShaderManager::reflectUniforms(ShaderId program) {
+    auto &locations = m_uniformLocations[program];
+    locations.clear();
+
+    int nUniforms     = 0;
+    int maxNameLength = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &nUniforms);
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+    std::vector<char> nameBuffer(std::max(maxNameLength, 1));
+    for (int i = 0; i < nUniforms; ++i) {
+      int nameLength = 0;
+      int size       = 0;
+      GLenum type    = 0;
+      glGetActiveUniform(program, i, maxNameLength, &nameLength, &size, &type, nameBuffer.data());
+
+      // Uniforms inside uniform blocks have no location
+      std::string name(nameBuffer.data(), nameLength);
+      int location = glGetUniformLocation(program, name.c_str());
+      if (location == -1)
+        continue;
+
+      locations[name] = location;
+
+      // Arrays are reported as 'name[0]', also allow referring to them by their base name
+      if (name.ends_with("[0]"))
+        locations[name.substr(0, name.size() - 3)] = location;
+    }
+  }
 } // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -0,0 +1,25 @@
+#include <TritiumEngine/Core/Application.hpp>
+#include <TritiumEngine/Rendering/Components/LodPolicy.hpp>
+#include <TritiumEngine/Rendering/Systems/LodSystem.hpp>
+#include <TritiumEngine/Utilities/Logger.hpp>
+
+using namespace TritiumEngine::Utilities;
+
+namespace TritiumEngine::Rendering
+{
+  LodSystem::LodSystem() : System() {
+    setUpdatePhase(UpdatePhase::FRAME);
+    writes<LodPolicy>();
+  }
+
+  void LodSystem::update(float dt) {
+    m_app->registry.view<LodPolicy>().each([dt](auto entity, LodPolicy &policy) {
+      if (!policy.addFrameTime(dt * 1000.f, dt))
+        return;
+
+      Logger::info("[LodSystem] {} level {} -> {}, average frame {:.2f}ms, target {:.2f}ms.",
+                   policy.getName(), policy.getPreviousLevel(), policy.getLevel(),
+                   policy.getAverageFrameMs(), policy.getTargetFrameMs());
+    });
+  }
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
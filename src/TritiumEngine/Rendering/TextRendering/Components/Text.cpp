@@ -2,49 +2,115 @@
 #include <TritiumEngine/Rendering/TextRendering/Components/Text.hpp>
 #include <TritiumEngine/Rendering/TextRendering/FontLoader.hpp>
 
-#include <GL/glew.h>
+#include <algorithm>
 
 namespace TritiumEngine::Rendering
 {
   Text::Text(const std::string &text, const std::string &font, float scaleFactor, Alignment alignment)
       : text(text), scaleFactor(scaleFactor), align(alignment),
-        m_font(ResourceManager<Font>::get(font + ".ttf")) {
-    // Bind vertex array object
-    glGenVertexArrays(1, &m_vao);
-    glBindVertexArray(m_vao);
-
-    // Bind vertex data buffer
-    glGenBuffers(1, &m_vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 4 * 4, NULL, GL_DYNAMIC_DRAW);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0);
-    glEnableVertexAttribArray(0);
-  }
+        m_font(ResourceManager<Font>::get(font + ".ttf")), m_layout(), m_layoutScaleFactor(0.f),
+        m_layoutAlign(alignment), m_layoutFont(nullptr) {}
+
+  /** @brief Obtains the total pixel width of the text string */
+  float Text::getPixelWidth() const { return getLayout().pixelWidth; }
+
+  /** @brief Obtains the max pixel height from all characters in the text string */
+  float Text::getPixelHeight() const { return getLayout().pixelHeight; }
+
+  /** @brief Obtains max pixel height of the font this text uses */
+  float Text::getMaxFontPixelHeight() const { return m_font->maxHeight * scaleFactor; }
+
+  /**
+   * @brief Obtains the glyph quads and bounds of the text. The layout is cached and only rebuilt
+   * once the text string, scale factor, alignment or font have changed.
+   */
+  const Text::Layout &Text::getLayout() const {
+    if (!isLayoutValid())
+      buildLayout();
 
-  Text::~Text() {
-    // Delete all buffer and vertex data
-    glDeleteVertexArrays(1, &m_vao);
-    glDeleteBuffers(1, &m_vbo);
+    return m_layout;
   }
 
-  /** @brief Obtains the total pixel width of the text string */
-  float Text::getPixelWidth() const {
-    float width = 0.f;
-    for (const char &c : text)
-      width += m_font->characters[c].advance >> 6;
+  /** @brief Changes the font the text is rendered with */
+  void Text::setFont(const std::string &font) {
+    m_font = ResourceManager<Font>::get(font + ".ttf");
+  }
 
-    return width * scaleFactor;
+  bool Text::isLayoutValid() const {
+    return m_layout.version != 0 && m_layoutFont == m_font.get() &&
+           m_layoutScaleFactor == scaleFactor && m_layoutAlign == align && m_layoutText == text;
   }
 
-  /** @brief Obtains the max pixel height from all characters in the text string */
-  float Text::getPixelHeight() const {
+  void Text::buildLayout() const {
+    m_layoutText        = text;
+    m_layoutScaleFactor = scaleFactor;
+    m_layoutAlign       = align;
+    m_layoutFont        = m_font.get();
+
+    // Measure the text first, as its alignment depends on the overall width
+    int width     = 0;
     int maxHeight = 0;
-    for (const char &c : text)
+    for (const char &c : text) {
+      width += m_font->characters[c].advance >> 6;
       maxHeight = std::max(m_font->characters[c].bearing.y, maxHeight);
+    }
+    m_layout.pixelWidth  = width * scaleFactor;
+    m_layout.pixelHeight = maxHeight * scaleFactor;
+
+    // Lay out glyph quads from the aligned starting position
+    glm::vec2 startPos = getStartPosition(m_layout.pixelWidth);
+    m_layout.glyphs.clear();
+    m_layout.glyphs.reserve(text.size());
+    for (const char &c : text) {
+      const auto &ch = m_font->characters[c];
+
+      // Calculate position and size for the given character
+      float xPos = startPos.x + ch.bearing.x * scaleFactor;
+      float yPos = startPos.y - (ch.size.y - ch.bearing.y) * scaleFactor;
+      m_layout.glyphs.push_back(
+          {{xPos, yPos}, glm::vec2(ch.size) * scaleFactor, ch.uvMin, ch.uvMax});
+
+      // Advance x-position for next glyph
+      startPos.x += (ch.advance >> 6) * scaleFactor;
+    }
 
-    return maxHeight * scaleFactor;
+    m_layout.version = s_nextLayoutVersion++;
   }
 
-  /** @brief Obtains max pixel height of the font this text uses */
-  float Text::getMaxFontPixelHeight() const { return m_font->maxHeight * scaleFactor; }
+  /** @brief Obtains the offset of the first glyph from the text origin based on its alignment */
+  glm::vec2 Text::getStartPosition(float pixelWidth) const {
+    auto startPos = glm::vec2{};
+
+    switch (align) {
+    case Alignment::TOP_LEFT:
+      startPos = {0.f, -getMaxFontPixelHeight()};
+      break;
+    case Alignment::TOP_CENTER:
+      startPos = {-pixelWidth * 0.5f, -getMaxFontPixelHeight()};
+      break;
+    case Alignment::TOP_RIGHT:
+      startPos = {-pixelWidth, -getMaxFontPixelHeight()};
+      break;
+    case Alignment::CENTER_LEFT:
+      startPos = {0.f, -getMaxFontPixelHeight() * 0.5f};
+      break;
+    case Alignment::CENTER:
+      startPos = {-pixelWidth * 0.5f, -getMaxFontPixelHeight() * 0.5f};
+      break;
+    case Alignment::CENTER_RIGHT:
+      startPos = {-pixelWidth, -getMaxFontPixelHeight() * 0.5f};
+      break;
+    case Alignment::BOTTOM_LEFT:
+      startPos = {0.f, 0.f};
+      break;
+    case Alignment::BOTTOM_CENTER:
+      startPos = {-pixelWidth * 0.5f, 0.f};
+      break;
+    case Alignment::BOTTOM_RIGHT:
+      startPos = {-pixelWidth, 0.f};
+      break;
+    }
+
+    return startPos;
+  }
 } // namespace TritiumEngine::Rendering
\ No newline at end of file
@@ -1,9 +1,11 @@
 #include <TritiumEngine/Rendering/TextRendering/FontLoader.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
 #include <TritiumEngine/Utilities/Logger.hpp>
 
 #include <GL/glew.h>
 
 #include <algorithm>
+#include <vector>
 
 using namespace TritiumEngine::Utilities;
 
@@ -50,7 +52,8 @@ namespace TritiumEngine::Rendering
       return false;
     }
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // disable byte-alignment restriction
+    // Render all glyphs first so they can be packed into a single atlas texture
+    std::vector<std::vector<unsigned char>> bitmaps(Font::CHAR_ARRAY_SIZE);
     for (unsigned char c = 0; c < Font::CHAR_ARRAY_SIZE; c++) {
       // Load character glyph
       ftError = FT_Load_Char(face, c, FT_LOAD_RENDER);
@@ -59,22 +62,13 @@ namespace TritiumEngine::Rendering
         continue;
       }
 
-      // Generate texture for glyph
+      // Keep a copy of the glyph bitmap, FreeType reuses the buffer for the next glyph
       const auto &bitmap = face->glyph->bitmap;
-      GLuint textureId;
-      glGenTextures(1, &textureId);
-      glBindTexture(GL_TEXTURE_2D, textureId);
-      glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, bitmap.width, bitmap.rows, 0, GL_RED, GL_UNSIGNED_BYTE,
-                   bitmap.buffer);
-
-      // Set texture options
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+      bitmaps[c].assign(bitmap.buffer, bitmap.buffer + bitmap.width * bitmap.rows);
 
       // Store character info in array
-      font->characters[c] = {textureId,
+      font->characters[c] = {{},
+                             {},
                              {bitmap.width, bitmap.rows},
                              {face->glyph->bitmap_left, face->glyph->bitmap_top},
                              face->glyph->advance.x};
@@ -82,6 +76,52 @@ namespace TritiumEngine::Rendering
       // Update max font height
       font->maxHeight = std::max(font->maxHeight, bitmap.rows);
     }
+
+    // Pack glyphs into rows (shelves) from left to right, starting a new row when the current one
+    // is full. Glyphs are padded so that linear filtering does not bleed in their neighbours.
+    std::vector<glm::ivec2> offsets(Font::CHAR_ARRAY_SIZE);
+    glm::ivec2 cursor = {ATLAS_PADDING, ATLAS_PADDING};
+    int rowHeight     = 0;
+    for (size_t c = 0; c < Font::CHAR_ARRAY_SIZE; c++) {
+      const auto &size = font->characters[c].size;
+      if (cursor.x + size.x + ATLAS_PADDING > ATLAS_WIDTH) {
+        cursor.x = ATLAS_PADDING;
+        cursor.y += rowHeight + ATLAS_PADDING;
+        rowHeight = 0;
+      }
+
+      offsets[c] = cursor;
+      cursor.x += size.x + ATLAS_PADDING;
+      rowHeight = std::max(rowHeight, size.y);
+    }
+    font->atlasSize = {ATLAS_WIDTH, cursor.y + rowHeight + ATLAS_PADDING};
+
+    // Copy glyph bitmaps into the atlas and work out their texture coordinates
+    std::vector<unsigned char> atlas(font->atlasSize.x * font->atlasSize.y, 0);
+    glm::vec2 texelSize = 1.f / glm::vec2(font->atlasSize);
+    for (size_t c = 0; c < Font::CHAR_ARRAY_SIZE; c++) {
+      auto &ch = font->characters[c];
+      for (int row = 0; row < ch.size.y; ++row)
+        std::copy_n(bitmaps[c].data() + row * ch.size.x, ch.size.x,
+                    atlas.data() + (offsets[c].y + row) * font->atlasSize.x + offsets[c].x);
+
+      ch.uvMin = glm::vec2(offsets[c]) * texelSize;
+      ch.uvMax = glm::vec2(offsets[c] + ch.size) * texelSize;
+    }
+
+    // Generate atlas texture
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // disable byte-alignment restriction
+    glGenTextures(1, &font->atlasTextureID);
+    GLState::bindTexture(GL_TEXTURE_2D, font->atlasTextureID);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, font->atlasSize.x, font->atlasSize.y, 0, GL_RED,
+                 GL_UNSIGNED_BYTE, atlas.data());
+
+    // Set texture options
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
     FT_Done_Face(face);
     FT_Done_FreeType(ft);
 
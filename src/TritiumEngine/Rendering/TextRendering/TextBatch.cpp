@@ -0,0 +1,151 @@
+#include <TritiumEngine/Rendering/GLState.hpp>
+#include <TritiumEngine/Rendering/ShaderManager.hpp>
+#include <TritiumEngine/Rendering/TextRendering/Font.hpp>
+#include <TritiumEngine/Rendering/TextRendering/TextBatch.hpp>
+
+#include <GL/glew.h>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace TritiumEngine::Rendering
+{
+  TextBatch::TextBatch() : m_capacity(0) {
+    glCreateVertexArrays(1, &m_vao);
+    glCreateBuffers(1, &m_vbo);
+    glCreateBuffers(1, &m_ebo);
+
+    // Vertex positions, texture coordinates and colors
+    glEnableVertexArrayAttrib(m_vao, 0);
+    glVertexArrayAttribFormat(m_vao, 0, 4, GL_FLOAT, GL_FALSE, offsetof(Vertex, position));
+    glVertexArrayAttribBinding(m_vao, 0, 0);
+    glEnableVertexArrayAttrib(m_vao, 1);
+    glVertexArrayAttribFormat(m_vao, 1, 2, GL_FLOAT, GL_FALSE, offsetof(Vertex, texCoords));
+    glVertexArrayAttribBinding(m_vao, 1, 0);
+    glEnableVertexArrayAttrib(m_vao, 2);
+    glVertexArrayAttribFormat(m_vao, 2, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(Vertex, color));
+    glVertexArrayAttribBinding(m_vao, 2, 0);
+
+    reserve(INITIAL_CAPACITY);
+  }
+
+  TextBatch::~TextBatch() {
+    GLState::deleteVertexArray(m_vao);
+    GLState::deleteBuffer(m_vbo);
+    GLState::deleteBuffer(m_ebo);
+  }
+
+  /**
+   * @brief Adds a text to the batch. Glyph quads are only generated on flush, and only if the
+   * batch differs from the one currently on the GPU.
+   * @param text The text to add
+   * @param shader The shader the text is drawn with
+   * @param transform Matrix transforming text space into clip space
+   * @param color Color of the text
+   */
+  void TextBatch::add(const Text &text, unsigned int shader, const glm::mat4 &transform,
+                      uint32_t color) {
+    // Fetching the layout here also rebuilds it if the text has changed
+    uint64_t layoutVersion = text.getLayout().version;
+    m_entries.push_back({&text, layoutVersion, shader, text.getFont(), transform, color});
+  }
+
+  /**
+   * @brief Draws all texts added since the last flush with one draw call per font and shader
+   * group, then clears the batch for the next frame. Vertex data is only rebuilt and uploaded if
+   * any of the texts changed.
+   * @param shaderManager The shader manager used to switch between shaders
+   */
+  void TextBatch::flush(ShaderManager &shaderManager) {
+    bool isUnchanged = m_entries.size() == m_lastEntries.size() &&
+                       std::equal(m_entries.begin(), m_entries.end(), m_lastEntries.begin(),
+                                  &TextBatch::isSameEntry);
+    if (!isUnchanged)
+      rebuild();
+
+    std::swap(m_entries, m_lastEntries);
+    m_entries.clear();
+    if (m_draws.empty())
+      return;
+
+    GLState::bindVertexArray(m_vao);
+    GLState::activeTexture(GL_TEXTURE0);
+    for (const auto &draw : m_draws) {
+      if (draw.shader != shaderManager.getCurrentShader())
+        shaderManager.use(draw.shader);
+      GLState::bindTexture(GL_TEXTURE_2D, draw.font->atlasTextureID);
+      glDrawElementsBaseVertex(GL_TRIANGLES, draw.nVertices / 4 * 6, GL_UNSIGNED_INT, 0,
+                               draw.baseVertex);
+    }
+  }
+
+  bool TextBatch::isSameEntry(const Entry &a, const Entry &b) {
+    return a.layoutVersion == b.layoutVersion && a.shader == b.shader && a.font == b.font &&
+           a.color == b.color && a.transform == b.transform;
+  }
+
+  // Transforms the cached glyph quads of all entries into their groups and uploads them
+  void TextBatch::rebuild() {
+    for (const auto &entry : m_entries) {
+      auto &vertices     = m_groups[{entry.shader, entry.font}];
+      const auto &glyphs = entry.text->getLayout().glyphs;
+      vertices.reserve(vertices.size() + glyphs.size() * 4);
+
+      // Text quads lie on the z = 0 plane, so each corner only needs the x/y axes and the origin
+      const glm::mat4 &transform = entry.transform;
+      for (const auto &glyph : glyphs) {
+        glm::vec4 origin = transform[0] * glyph.position.x + transform[1] * glyph.position.y +
+                           transform[3];
+        glm::vec4 right  = transform[0] * glyph.size.x;
+        glm::vec4 up     = transform[1] * glyph.size.y;
+
+        vertices.push_back({origin, {glyph.uvMin.x, glyph.uvMax.y}, entry.color});
+        vertices.push_back({origin + right, {glyph.uvMax.x, glyph.uvMax.y}, entry.color});
+        vertices.push_back({origin + up, {glyph.uvMin.x, glyph.uvMin.y}, entry.color});
+        vertices.push_back({origin + right + up, {glyph.uvMax.x, glyph.uvMin.y}, entry.color});
+      }
+    }
+
+    size_t nGlyphs = 0;
+    for (const auto &[key, vertices] : m_groups)
+      nGlyphs += vertices.size() / 4;
+    reserve(nGlyphs);
+
+    // Orphan the previous storage, then upload every group back to back
+    m_draws.clear();
+    glNamedBufferData(m_vbo, m_capacity * 4 * sizeof(Vertex), NULL, GL_STREAM_DRAW);
+    int baseVertex = 0;
+    for (auto &[key, vertices] : m_groups) {
+      auto nVertices = static_cast<int>(vertices.size());
+      if (nVertices == 0)
+        continue;
+
+      glNamedBufferSubData(m_vbo, baseVertex * sizeof(Vertex), nVertices * sizeof(Vertex),
+                           vertices.data());
+      m_draws.push_back({key.first, key.second, nVertices, baseVertex});
+      baseVertex += nVertices;
+      vertices.clear();
+    }
+  }
+
+  /**
+   * @brief Grows the vertex and index buffers to hold at least the given number of glyphs. Indices
+   * never change, as every glyph is a quad made up of the same two triangles.
+   */
+  void TextBatch::reserve(size_t nGlyphs) {
+    if (nGlyphs <= m_capacity)
+      return;
+
+    m_capacity = std::max(nGlyphs, m_capacity * 2);
+
+    std::vector<unsigned int> indices;
+    indices.reserve(m_capacity * 6);
+    for (unsigned int i = 0; i < m_capacity * 4; i += 4)
+      indices.insert(indices.end(), {i, i + 1, i + 2, i + 1, i + 3, i + 2});
+
+    glNamedBufferData(m_ebo, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+    glNamedBufferData(m_vbo, m_capacity * 4 * sizeof(Vertex), NULL, GL_STREAM_DRAW);
+    glVertexArrayVertexBuffer(m_vao, 0, m_vbo, 0, sizeof(Vertex));
+    glVertexArrayElementBuffer(m_vao, m_ebo);
+  }
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
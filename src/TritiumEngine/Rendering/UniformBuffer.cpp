@@ -0,0 +1,41 @@
+#include <TritiumEngine/Rendering/UniformBuffer.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
+#include <TritiumEngine/Utilities/Logger.hpp>
+
+#include <GL/glew.h>
+
+using namespace TritiumEngine::Utilities;
+
+namespace TritiumEngine::Rendering
+{
+  UniformBuffer::UniformBuffer(size_t size) : m_size(size) {
+    glCreateBuffers(1, &m_id);
+    glNamedBufferData(m_id, m_size, NULL, GL_DYNAMIC_DRAW);
+  }
+
+  UniformBuffer::~UniformBuffer() { GLState::deleteBuffer(m_id); }
+
+  /**
+   * @brief Uploads data into the buffer
+   * @param data Pointer to the data to upload
+   * @param size Size of the data in bytes
+   * @param offset Offset into the buffer in bytes to start writing at
+   */
+  void UniformBuffer::setData(const void *data, size_t size, size_t offset) const {
+    if (offset + size > m_size) {
+      Logger::warn("[UniformBuffer] Data of size {} at offset {} exceeds buffer size {}.", size,
+                   offset, m_size);
+      return;
+    }
+
+    glNamedBufferSubData(m_id, offset, size, data);
+  }
+
+  /**
+   * @brief Binds the buffer to a uniform block binding point
+   * @param binding The binding point shaders read the uniform block from
+   */
+  void UniformBuffer::bind(unsigned int binding) const {
+    GLState::bindBufferBase(GL_UNIFORM_BUFFER, binding, m_id);
+  }
+} // namespace TritiumEngine::Rendering
\ No newline at end of file
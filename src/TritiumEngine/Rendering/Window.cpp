@@ -1,4 +1,5 @@
 #include <TritiumEngine/Rendering/Components/FrameBuffer.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
 #include <TritiumEngine/Rendering/Primitives.hpp>
 #include <TritiumEngine/Rendering/Window.hpp>
 #include <TritiumEngine/Utilities/Logger.hpp>
@@ -110,8 +111,8 @@ namespace TritiumEngine::Rendering
       return;
 
     // Delete screen quad data
-    glDeleteVertexArrays(1, &m_screenQuadVao);
-    glDeleteBuffers(1, &m_screenQuadVbo);
+    GLState::deleteVertexArray(m_screenQuadVao);
+    GLState::deleteBuffer(m_screenQuadVbo);
 
     glfwDestroyWindow(m_windowHandle);
 
@@ -164,11 +165,11 @@ namespace TritiumEngine::Rendering
     glClear(GL_COLOR_BUFFER_BIT);
 
     m_shaderManager.use("screen");
-    glBindVertexArray(m_screenQuadVao);
-    glDisable(GL_DEPTH_TEST);
+    GLState::bindVertexArray(m_screenQuadVao);
+    GLState::setDepthTest(false);
 
     auto textureId = m_frameBuffer->getTextureAttachment(TextureAttachment::COLOR)->getId();
-    glBindTexture(GL_TEXTURE_2D, textureId);
+    GLState::bindTexture(GL_TEXTURE_2D, textureId);
     glDrawArrays(GL_TRIANGLES, 0, 6);
   }
 
@@ -219,15 +220,15 @@ namespace TritiumEngine::Rendering
     };
 
     // Delete old screen quad vao/vbo if previously created
-    glDeleteVertexArrays(1, &m_screenQuadVao);
-    glDeleteBuffers(1, &m_screenQuadVbo);
+    GLState::deleteVertexArray(m_screenQuadVao);
+    GLState::deleteBuffer(m_screenQuadVbo);
 
     // Create screen quad
     glGenVertexArrays(1, &m_screenQuadVao);
-    glBindVertexArray(m_screenQuadVao);
+    GLState::bindVertexArray(m_screenQuadVao);
 
     glGenBuffers(1, &m_screenQuadVbo);
-    glBindBuffer(GL_ARRAY_BUFFER, m_screenQuadVbo);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_screenQuadVbo);
     glBufferData(GL_ARRAY_BUFFER, sizeof(screenQuadData), &screenQuadData, GL_STATIC_DRAW);
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void *)0);
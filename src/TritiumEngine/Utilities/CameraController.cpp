@@ -1,5 +1,7 @@
 #include <TritiumEngine/Utilities/CameraController.hpp>
 
+#include <algorithm>
+
 using namespace TritiumEngine::Rendering;
 
 namespace
@@ -22,37 +24,37 @@ namespace TritiumEngine::Utilities
     for (auto key : m_actionKeys[CameraAction::MOVE_FORWARD])
       m_callbacks.push_back(
           m_input.addKeyCallback(key, KeyState::PRESSED, [this, &transform, &camera](float dt) {
-            transform.position += transform.getFront() * moveSpeed * getOrthoScale(camera).z * dt;
+            transform.translate(transform.getFront() * moveSpeed * getOrthoScale(camera).z * dt);
           }));
 
     for (auto key : m_actionKeys[CameraAction::MOVE_BACKWARD])
       m_callbacks.push_back(
           m_input.addKeyCallback(key, KeyState::PRESSED, [this, &transform, &camera](float dt) {
-            transform.position += transform.getFront() * -moveSpeed * getOrthoScale(camera).z * dt;
+            transform.translate(transform.getFront() * -moveSpeed * getOrthoScale(camera).z * dt);
           }));
 
     for (auto key : m_actionKeys[CameraAction::MOVE_LEFT])
       m_callbacks.push_back(
           m_input.addKeyCallback(key, KeyState::PRESSED, [this, &transform, &camera](float dt) {
-            transform.position += transform.getRight() * -moveSpeed * getOrthoScale(camera).x * dt;
+            transform.translate(transform.getRight() * -moveSpeed * getOrthoScale(camera).x * dt);
           }));
 
     for (auto key : m_actionKeys[CameraAction::MOVE_RIGHT])
       m_callbacks.push_back(
           m_input.addKeyCallback(key, KeyState::PRESSED, [this, &transform, &camera](float dt) {
-            transform.position += transform.getRight() * moveSpeed * getOrthoScale(camera).x * dt;
+            transform.translate(transform.getRight() * moveSpeed * getOrthoScale(camera).x * dt);
           }));
 
     for (auto key : m_actionKeys[CameraAction::MOVE_DOWN])
       m_callbacks.push_back(
           m_input.addKeyCallback(key, KeyState::PRESSED, [this, &transform, &camera](float dt) {
-            transform.position += Transform::UP * -moveSpeed * getOrthoScale(camera).y * dt;
+            transform.translate(Transform::UP * -moveSpeed * getOrthoScale(camera).y * dt);
           }));
 
     for (auto key : m_actionKeys[CameraAction::MOVE_UP])
       m_callbacks.push_back(
           m_input.addKeyCallback(key, KeyState::PRESSED, [this, &transform, &camera](float dt) {
-            transform.position += Transform::UP * moveSpeed * getOrthoScale(camera).y * dt;
+            transform.translate(Transform::UP * moveSpeed * getOrthoScale(camera).y * dt);
           }));
 
     for (auto key : m_actionKeys[CameraAction::TURN_LEFT])
@@ -135,11 +137,10 @@ namespace TritiumEngine::Utilities
 
   void CameraController::addZoom(Camera &camera, float zoom) {
     if (camera.projection == Camera::Projection::ORTHOGRAPHIC) {
-      camera.transform.scale += zoom;
-      camera.transform.scale.x = std::min(camera.transform.scale.x, maxOrthographicZoom);
-      camera.transform.scale.y = std::min(camera.transform.scale.y, maxOrthographicZoom);
-      camera.transform.scale.x = std::max(camera.transform.scale.x, minOrthographicZoom);
-      camera.transform.scale.y = std::max(camera.transform.scale.y, minOrthographicZoom);
+      glm::vec3 scale = camera.transform.getScale() + zoom;
+      scale.x         = std::clamp(scale.x, minOrthographicZoom, maxOrthographicZoom);
+      scale.y         = std::clamp(scale.y, minOrthographicZoom, maxOrthographicZoom);
+      camera.transform.setScale(scale);
     } else {
       camera.fov += zoom;
       camera.fov = std::min(camera.fov, maxFov);
@@ -150,6 +151,6 @@ namespace TritiumEngine::Utilities
   glm::vec3 CameraController::getOrthoScale(const Camera &camera) const {
     bool useOrthoScale =
         camera.projection == Projection::ORTHOGRAPHIC && scaleOrthographicMoveSpeedWithZoom;
-    return useOrthoScale ? camera.transform.scale : glm::vec3{1.f};
+    return useOrthoScale ? camera.transform.getScale() : glm::vec3{1.f};
   }
 } // namespace TritiumEngine::Utilities
\ No newline at end of file
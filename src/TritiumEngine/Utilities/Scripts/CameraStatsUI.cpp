@@ -23,7 +23,7 @@ namespace TritiumEngine::Utilities
     m_sumDt = 0.f;
 
     auto &registry       = m_app->registry;
-    const auto &position = m_camera.transform.position;
+    const auto &position = m_camera.transform.getPosition();
     float pitch          = glm::degrees(m_cameraController.getPitch());
     float yaw            = glm::degrees(m_cameraController.getYaw());
     float fov            = glm::degrees(m_camera.fov);
@@ -2,7 +2,9 @@
 
 #include <TritiumEngine/Core/Application.hpp>
 #include <TritiumEngine/Core/Components/Transform.hpp>
+#include <TritiumEngine/Rendering/Components/LodPolicy.hpp>
 #include <TritiumEngine/Rendering/Components/Shader.hpp>
+#include <TritiumEngine/Rendering/GLState.hpp>
 #include <TritiumEngine/Rendering/TextRendering/Components/Text.hpp>
 #include <TritiumEngine/Utilities/ColorUtils.hpp>
 #include <TritiumEngine/Utilities/Scripts/FpsStatsUI.hpp>
@@ -25,6 +27,17 @@ namespace TritiumEngine::Utilities
     m_app->registry.get<Text>(m_fpsText).text = std::format("FPS:   {:3.1f}", 1.f / avgDt);
     m_app->registry.get<Text>(m_frameTimeText).text =
         std::format("Frame: {:3.2f}ms", avgDt * 1000.f);
+    m_app->registry.get<Text>(m_glStateText).text =
+        std::format("GL:    {} set, {} skipped", GLState::getAppliedChanges(),
+                    GLState::getAvoidedChanges());
+
+    // Current level and number of level changes of every level of detail policy
+    std::string lodStats = "LOD:  ";
+    m_app->registry.view<LodPolicy>().each([&lodStats](auto entity, const LodPolicy &policy) {
+      lodStats += std::format(" {} {}/{} ({} changes)", policy.getName(), policy.getLevel(),
+                              policy.getNumLevels() - 1, policy.getNumTransitions());
+    });
+    m_app->registry.get<Text>(m_lodText).text = lodStats;
   }
 
   void FpsStatsUI::onEnable(bool enable) {
@@ -40,12 +53,16 @@ namespace TritiumEngine::Utilities
   void FpsStatsUI::initUI() {
     addText(m_fpsText, "FPS:", {-0.98f, 0.98f, 0.f});
     addText(m_frameTimeText, "Frame:", {-0.98f, 0.93f, 0.f});
+    addText(m_glStateText, "GL:", {-0.98f, 0.88f, 0.f});
+    addText(m_lodText, "LOD:", {-0.98f, 0.83f, 0.f});
   }
 
   void FpsStatsUI::destroyUI() {
     auto &registry = m_app->registry;
     registry.destroy(m_fpsText);
     registry.destroy(m_frameTimeText);
+    registry.destroy(m_glStateText);
+    registry.destroy(m_lodText);
   }
 
   void FpsStatsUI::addText(entt::entity &entity, const std::string &text, glm::vec3 position) {
@@ -0,0 +1,86 @@
+#include <TritiumEngine/Utilities/SimdUtils.hpp>
+
+#include <cstdint>
+
+#ifdef TRITIUM_SIMD_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace TritiumEngine::Utilities
+{
+  namespace
+  {
+#ifdef TRITIUM_SIMD_X86
+    void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#ifdef _MSC_VER
+      int info[4];
+      __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+      for (int i = 0; i < 4; ++i)
+        regs[i] = static_cast<uint32_t>(info[i]);
+#else
+      __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+    }
+
+    uint64_t getEnabledXState() {
+#ifdef _MSC_VER
+      return _xgetbv(0);
+#else
+      uint32_t eax, edx;
+      __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+      return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+    }
+#endif
+
+    SimdUtils::Level detectLevel() {
+#ifdef TRITIUM_SIMD_X86
+      uint32_t regs[4];
+      cpuid(0, 0, regs);
+      uint32_t maxLeaf = regs[0];
+
+      cpuid(1, 0, regs);
+      bool hasSse41   = regs[2] & (1u << 19);
+      bool hasFma     = regs[2] & (1u << 12);
+      bool hasOsxsave = regs[2] & (1u << 27);
+      bool hasAvx     = regs[2] & (1u << 28);
+
+      // The OS must also save the upper halves of the YMM registers on context switches
+      bool hasAvxState = hasOsxsave && (getEnabledXState() & 0x6) == 0x6;
+
+      bool hasAvx2 = false;
+      if (maxLeaf >= 7) {
+        cpuid(7, 0, regs);
+        hasAvx2 = regs[1] & (1u << 5);
+      }
+
+      if (hasAvx && hasAvxState && hasAvx2 && hasFma)
+        return SimdUtils::Level::AVX2;
+      if (hasSse41)
+        return SimdUtils::Level::SSE4;
+#endif
+      return SimdUtils::Level::SCALAR;
+    }
+  } // namespace
+
+  /** @brief Determines the widest instruction set supported by the CPU and operating system */
+  SimdUtils::Level SimdUtils::GetSupportedLevel() {
+    static const Level level = detectLevel();
+    return level;
+  }
+
+  const char *SimdUtils::GetLevelName(Level level) {
+    switch (level) {
+    case Level::AVX2:
+      return "AVX2";
+    case Level::SSE4:
+      return "SSE4";
+    default:
+      return "Scalar";
+    }
+  }
+} // namespace TritiumEngine::Utilities
\ No newline at end of file
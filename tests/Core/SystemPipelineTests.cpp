@@ -0,0 +1,52 @@
+#include "Tests.hpp"
+
+#include <TritiumEngine/Core/SystemPipeline.hpp>
+
+#include <vector>
+
+using namespace TritiumEngine::Core;
+
+namespace
+{
+  /** @brief Records the order in which pipeline systems are updated */
+  template <int Id> class RecordingSystem : public System {
+  public:
+    RecordingSystem(std::vector<int> &log, UpdatePhase phase) : m_log(log) {
+      setUpdatePhase(phase);
+    }
+
+    void update(float dt) override { m_log.push_back(Id); }
+
+  private:
+    std::vector<int> &m_log;
+  };
+
+  using UpdatePhase = System::UpdatePhase;
+} // namespace
+
+TEST_CASE(PipelineUpdatesSystemsInDeclarationOrder) {
+  std::vector<int> log;
+  SystemPipeline<RecordingSystem<0>, RecordingSystem<1>, RecordingSystem<2>> pipeline(
+      RecordingSystem<0>(log, UpdatePhase::FRAME), RecordingSystem<1>(log, UpdatePhase::FRAME),
+      RecordingSystem<2>(log, UpdatePhase::FRAME));
+
+  pipeline.update(UpdatePhase::FRAME, 0.f);
+  CHECK(pipeline.size() == 3);
+  CHECK((log == std::vector<int>{0, 1, 2}));
+  return true;
+}
+
+TEST_CASE(PipelineOnlyUpdatesSystemsOfTheGivenPhase) {
+  std::vector<int> log;
+  SystemPipeline<RecordingSystem<0>, RecordingSystem<1>> pipeline(
+      RecordingSystem<0>(log, UpdatePhase::SIMULATION),
+      RecordingSystem<1>(log, UpdatePhase::FRAME));
+
+  pipeline.update(UpdatePhase::SIMULATION, 0.f);
+  CHECK((log == std::vector<int>{0}));
+
+  log.clear();
+  pipeline.update(UpdatePhase::FRAME, 0.f);
+  CHECK((log == std::vector<int>{1}));
+  return true;
+}
\ No newline at end of file
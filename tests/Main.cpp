@@ -0,0 +1,13 @@
+#include "Tests.hpp"
+
+#include <cstdio>
+
+int main() {
+  int nFailed = 0;
+  for (const auto &test : Tests::getRegistry()) {
+    bool passed = test.run();
+    std::printf("[%s] %s\n", passed ? "PASS" : "FAIL", test.name);
+    nFailed += passed ? 0 : 1;
+  }
+  return nFailed == 0 ? 0 : 1;
+}
\ No newline at end of file
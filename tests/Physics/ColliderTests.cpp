@@ -0,0 +1,46 @@
+#include "Tests.hpp"
+
+#include <TritiumEngine/Physics/Collider.hpp>
+#include <TritiumEngine/Physics/Components/AABB.hpp>
+
+using namespace TritiumEngine::Physics;
+
+namespace
+{
+  constexpr static float RADIUS = 6.f;
+}
+
+TEST_CASE(TouchingCirclesCollide) {
+  // Circles of radius r are bounded by AABB{r, r}, so centers 2r apart just touch
+  AABB a{RADIUS, RADIUS};
+  AABB b{RADIUS, RADIUS};
+  glm::vec2 posA = {0.f, 0.f};
+  glm::vec2 posB = {2.f * RADIUS, 0.f};
+
+  CHECK(Collider::CheckCollision(posA, a.getHalfExtents(), posB, b.getHalfExtents()));
+  CHECK(Collider::CheckCollision(posB, b.getHalfExtents(), posA, a.getHalfExtents()));
+  return true;
+}
+
+TEST_CASE(SeparatedCirclesDoNotCollide) {
+  AABB a{RADIUS, RADIUS};
+  AABB b{RADIUS, RADIUS};
+  glm::vec2 posA = {0.f, 0.f};
+  glm::vec2 posB = {2.f * RADIUS + 0.01f, 0.f};
+
+  CHECK(!Collider::CheckCollision(posA, a.getHalfExtents(), posB, b.getHalfExtents()));
+  return true;
+}
+
+TEST_CASE(OverlappingCirclesPenetrateByOverlap) {
+  AABB a{RADIUS, RADIUS};
+  AABB b{RADIUS, RADIUS};
+  glm::vec2 posA = {0.f, 0.f};
+  glm::vec2 posB = {2.f * RADIUS - 1.f, 0.f};
+
+  glm::vec2 penetration =
+      Collider::GetPenetration(posA, a.getHalfExtents(), posB, b.getHalfExtents());
+  CHECK(penetration.x == 1.f);
+  CHECK(penetration.y == 2.f * RADIUS);
+  return true;
+}
\ No newline at end of file
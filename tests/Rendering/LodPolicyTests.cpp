@@ -0,0 +1,46 @@
+#include "Tests.hpp"
+
+#include <TritiumEngine/Rendering/Components/LodPolicy.hpp>
+
+using namespace TritiumEngine::Rendering;
+
+namespace
+{
+  constexpr static float TARGET_MS = 1000.f / 60.f;
+  constexpr static float LOAD_MS   = 3000.f;
+
+  /** @brief Feeds frames of the given duration, returning whether the level ever changed */
+  bool addFrames(LodPolicy &policy, float frameMs, int nFrames) {
+    bool changed = false;
+    for (int i = 0; i < nFrames; ++i)
+      changed |= policy.addFrameTime(frameMs, frameMs / 1000.f);
+    return changed;
+  }
+} // namespace
+
+TEST_CASE(LoadStallAfterCreationKeepsLevel) {
+  LodPolicy policy("test", 4, TARGET_MS);
+  addFrames(policy, LOAD_MS, 1);
+
+  CHECK(!addFrames(policy, TARGET_MS, 120));
+  CHECK(policy.getLevel() == 0);
+  return true;
+}
+
+TEST_CASE(SingleStallKeepsLevel) {
+  LodPolicy policy("test", 4, TARGET_MS);
+  addFrames(policy, TARGET_MS, 60);
+  addFrames(policy, LOAD_MS, 1);
+
+  CHECK(!addFrames(policy, TARGET_MS, 120));
+  CHECK(policy.getLevel() == 0);
+  return true;
+}
+
+TEST_CASE(SustainedSlowFramesCoarsenLevel) {
+  LodPolicy policy("test", 4, TARGET_MS);
+
+  CHECK(addFrames(policy, 2.f * TARGET_MS, 25));
+  CHECK(policy.getLevel() == 1);
+  return true;
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdio>
+#include <vector>
+
+#define TEST_CASE(name)                                                                            \
+  static bool name();                                                                              \
+  static Tests::TestRegistrar name##Registrar(#name, &name);                                       \
+  static bool name()
+
+#define CHECK(condition)                                                                           \
+  if (!(condition)) {                                                                              \
+    std::printf("  %s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition);                    \
+    return false;                                                                                  \
+  }
+
+namespace Tests
+{
+  /** @brief A single test case, returning whether all of its checks passed */
+  struct TestCase {
+    const char *name;
+    bool (*run)();
+  };
+
+  inline std::vector<TestCase> &getRegistry() {
+    static std::vector<TestCase> registry;
+    return registry;
+  }
+
+  /** @brief Registers a test case at static initialization */
+  struct TestRegistrar {
+    TestRegistrar(const char *name, bool (*run)()) { getRegistry().push_back({name, run}); }
+  };
+} // namespace Tests
\ No newline at end of file